@@ -8,18 +8,78 @@
 			Inherits from QGLWidget, which is OpenGL
 */
 #include	"cube.h"
+#include	<cmath>
+#include	<cstddef>
+#include	<cstdlib>
+#include	<cstring>
+
+/*
+	The instanced renderer: the mesh vertex moved to the center of its cell,
+		in the colour of the cell. GLSL 1.20, so that any GL 2.1 with instancing runs it.
+*/
+static const char *vertexShader =
+	"#version 120\n"
+	"attribute vec3 vertex;\n"		// of the mesh
+	"attribute vec3 offset;\n"		// of the cell
+	"attribute vec4 color;\n"
+	"varying vec4 cellColor;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_Position	= gl_ModelViewProjectionMatrix * vec4(offset + 1.4 * vertex, 1.0);\n"
+	"	cellColor	= color;\n"
+	"}\n";
+
+static const char *fragmentShader =
+	"#version 120\n"
+	"varying vec4 cellColor;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_FragColor	= cellColor;\n"
+	"}\n";
+
+/*
+	Rotate the vector v by degrees about axis (0 for x, 1 for y, 2 for z), as glRotated does.
+*/
+static void rotate(double *v, int axis, double degrees)
+{
+	double angle	= degrees * M_PI / 180.0;
+	double c	= cos(angle);
+	double s	= sin(angle);
+	int i		= (axis + 1) % 3;
+	int j		= (axis + 2) % 3;
+	double vi	= v[i];
+	double vj	= v[j];
+
+	v[i]	= c * vi - s * vj;
+	v[j]	= s * vi + c * vj;
+}
 
 /*
 	Constructor
 	Setting up the cube, default rotation angle, and default cube selected.
 	Assigning color: 1st player is green; 2nd player is blue; white for blank.
+	The board is 3x3x3 until setSize is called.
 */
 Cube::Cube(QWidget *p, QGLWidget *shareWidget)
-	: QGLWidget(p, shareWidget)
+	: QGLWidget(p, shareWidget), m_mesh(QGLBuffer::VertexBuffer), m_instances(QGLBuffer::VertexBuffer)
 {
+	m_size		= 3;
+	m_program	= 0;
+	m_dirtyFirst	= MaxSize * MaxSize * MaxSize;
+	m_dirtyLast	= 0;
+	m_drawArraysInstanced	= 0;
+	m_vertexAttribDivisor	= 0;
+	m_initialized	= false;
+	m_snapshot	= 0;
+	m_stale		= true;
+	resetFrameStats();
+
 	xRot 		= 300;
 	yRot 		= 360;
 	zRot 		= 0;
+	m_paintedRot[0]	= xRot;
+	m_paintedRot[1]	= yRot;
+	m_paintedRot[2]	= zRot;
 
 	currX 		= 0;
 	currY		= 2;
@@ -29,26 +89,42 @@ Cube::Cube(QWidget *p, QGLWidget *shareWidget)
 	m_minCube	= QColor(Qt::blue);
 	m_blankCube	= QColor(Qt::white);
 
-	for (int x = 0; x < 3; x++)
-		for (int y = 0; y < 3; y++)
-			for (int z = 0; z < 3; z++)
-			{
-				cubeObj[x][y][z] = 0;
+	for (int x = 0; x < MaxSize; x++)
+		for (int y = 0; y < MaxSize; y++)
+			for (int z = 0; z < MaxSize; z++)
 				markedField[x][y][z] = Blank;
-			}
+	memset(m_cells, 0, sizeof(m_cells));
 }
 
 /*
 	Destructor
-	delete opengl list which contains cube specifications.
+	delete the GL objects of the widget: the cube mesh and, if they were made,
+		the instanced renderer, its instance buffer and the framebuffer of renderImage.
 */
 Cube::~Cube()
 {
 	makeCurrent();
-	for (int x = 0; x < 3; x++)
-		for (int y = 0; y < 3; y++)
-			for (int z = 0; z < 3; z++)
-				glDeleteLists(cubeObj[x][y][z], 1);
+	delete m_snapshot;
+	delete m_program;
+	m_instances.destroy();
+	m_mesh.destroy();
+}
+
+/*
+	Show a size x size x size board (3 to MaxSize) and start it over.
+*/
+void Cube::setSize(int size)
+{
+	m_size	= qBound(3, size, (int)MaxSize);
+	reset();
+}
+
+/*
+	Number of squares along each edge of the board.
+*/
+int Cube::size()
+{
+	return m_size;
 }
 
 /*
@@ -59,7 +135,7 @@ void Cube::changeXAxis(int dx)
 {
 	currX	+= dx;
 
-	currX	= currX > 2 ? 2 : currX;
+	currX	= currX > m_size - 1 ? m_size - 1 : currX;
 	currX	= currX < 0 ? 0 : currX;
 
 	updateCube();
@@ -73,7 +149,7 @@ void Cube::changeYAxis(int dy)
 {
 	currY	+= dy;
 
-	currY	= currY > 2 ? 2 : currY;
+	currY	= currY > m_size - 1 ? m_size - 1 : currY;
 	currY	= currY < 0 ? 0 : currY;
 
 	updateCube();
@@ -87,7 +163,7 @@ void Cube::changeZAxis(int dz)
 {
 	currZ	+= dz;
 
-	currZ	= currZ > 2 ? 2 : currZ;
+	currZ	= currZ > m_size - 1 ? m_size - 1 : currZ;
 	currZ	= currZ < 0 ? 0 : currZ;
 
 	updateCube();
@@ -106,6 +182,16 @@ void Cube::setAxis(int x, int y, int z)
 	updateCube();
 }
 
+/*
+	Set the view: the rotation about the x, y and z axis, in 1/16 degree.
+*/
+void Cube::setRotation(int x, int y, int z)
+{
+	setXRotation(x);
+	setYRotation(y);
+	setZRotation(z);
+}
+
 /*
 	Only allow to mark blank square.
 */
@@ -129,22 +215,22 @@ void Cube::reset()
 	zRot 		= 0;
 
 	currX 		= 0;
-	currY		= 2;
+	currY		= m_size - 1;
 	currZ		= 0;
 
-	for (int x = 0; x < 3; x++)
-		for (int y = 0; y < 3; y++)
-			for (int z = 0; z < 3; z++)
-			{
-				cubeObj[x][y][z] = 0;
+	for (int x = 0; x < MaxSize; x++)
+		for (int y = 0; y < MaxSize; y++)
+			for (int z = 0; z < MaxSize; z++)
 				markedField[x][y][z] = Blank;
-			}
 	updateCube();
+	scheduleRepaint();		// for the view, if no cell has changed
 }
 
 /*
 	Protected function.
 	initialize opengl.
+	The cube mesh is uploaded here, once for the life of the context,
+		and the instanced renderer is set up if the GL can run it.
 */
 void Cube::initializeGL()
 {
@@ -153,15 +239,90 @@ void Cube::initializeGL()
      	glEnable(GL_TEXTURE_2D);
 	glEnable(GL_LINE_SMOOTH);
 	glEnable(GL_BLEND);
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+	makeMesh();
+	makeProgram();
 	updateCube();
+	m_initialized	= true;
+}
+
+/*
+	Repaint statistics since the widget was made or resetFrameStats was called.
+*/
+const Cube::FrameStats &Cube::frameStats() const
+{
+	return m_frameStats;
+}
+
+/*
+	Start the repaint statistics over.
+*/
+void Cube::resetFrameStats()
+{
+	memset(&m_frameStats, 0, sizeof(m_frameStats));
+}
+
+/*
+	Draw the board as it is now into a side x side image, the same view as on screen,
+		without showing the widget or touching the window.
+	The image is drawn into a framebuffer object, which is kept for the next call of the
+		same side: a batch of images costs one GL context and one framebuffer.
+	Return a null image if the GL has no framebuffer objects.
+*/
+QImage Cube::renderImage(int side)
+{
+	makeCurrent();
+	if (!m_initialized)
+		glInit();
+	if (!QGLFramebufferObject::hasOpenGLFramebufferObjects())
+		return QImage();
+
+	if (!m_snapshot || (m_snapshot->width() != side))
+	{
+		delete m_snapshot;
+		m_snapshot	= new QGLFramebufferObject(side, side, QGLFramebufferObject::Depth);
+	}
+	if (!m_snapshot->isValid())
+		return QImage();
+
+	m_snapshot	->bind();
+	resizeGL(side, side);
+	drawBoard();
+	QImage image	= m_snapshot->toImage();
+	m_snapshot	->release();
+	resizeGL(width(), height());
+	return image;
 }
 
 /*
 	Protected function
 	this function is called every times a cube is updated.
+	The time spent in it goes to the frame statistics.
 */
 void Cube::paintGL()
+{
+	QElapsedTimer time;
+	time.start();
+
+	drawBoard();
+
+	m_stale		= false;
+	m_paintedRot[0]	= xRot;
+	m_paintedRot[1]	= yRot;
+	m_paintedRot[2]	= zRot;
+	m_lastFrame.start();
+
+	qint64 nsecs	= time.nsecsElapsed();
+	m_frameStats.frames++;
+	m_frameStats.paintNsecs	+= nsecs;
+	m_frameStats.worstNsecs	= qMax(m_frameStats.worstNsecs, nsecs);
+}
+
+/*
+	Clear the current framebuffer and draw the board in it, for paintGL and renderImage.
+*/
+void Cube::drawBoard()
 {
 	QColor m_color(Qt::lightGray);
 
@@ -174,12 +335,24 @@ void Cube::paintGL()
 	glRotated(yRot / 16.0, 0.0, 1.0, 0.0);
 	glRotated(zRot / 16.0, 0.0, 0.0, 1.0);
 
-	int indX, indY, indZ;
-	double x, y, z;
-	for (indX = 0, x = -1.0; x <= 1.0; x++, indX++)
-		for (indY = 0, y = -1.0; y <= 1.0; y++, indY++)
-			for (indZ = 0, z = -1.0; z <= 1.0; z++, indZ++)
-				drawCube(cubeObj[indX][indY][indZ], x, y, z);
+	// a larger board is scaled down to the size of 3x3x3
+	double scale	= 3.0 / m_size;
+	glScaled(scale, scale, scale);
+
+	if (m_program)
+		drawInstanced();
+	else
+	{
+		m_mesh.bind();
+		glEnableClientState(GL_VERTEX_ARRAY);
+		glVertexPointer(3, GL_FLOAT, 0, 0);
+
+		for (int i = 0; i < m_size * m_size * m_size; i++)
+			drawCube(m_cells[i]);
+
+		glDisableClientState(GL_VERTEX_ARRAY);
+		m_mesh.release();
+	}
 }
 
 /*
@@ -200,15 +373,12 @@ void Cube::resizeGL(int w, int h)
 }
 
 /*
-	A cube is made based on 3 parameters (selected, active, who owns it)
-	If a cube is selected, it will paint a red border.
-	If a cube is active, it will paint white with no transparency.
-	If a cube is owned, it will paint the appropriate color.
-	This function return a "specification" for the cube, which is stored in a 3D array.
+	The mesh every cell is drawn with, in the vertex buffer m_mesh:
+		the outline of each face as a line strip, then the faces as quads, slightly inside,
+		then the outlines again as separate lines, for the instanced renderer.
 */
-GLuint Cube::makeCube(bool selectCube, bool transparent, PlayerCube p)
+void Cube::makeMesh()
 {
-	QColor m_lineColor, m_cubeColor;
 	static const int coords[6][4][3] = {
 	         { { +1, -1, -1 }, { -1, -1, -1 }, { -1, +1, -1 }, { +1, +1, -1 } },
 	         { { +1, +1, -1 }, { -1, +1, -1 }, { -1, +1, +1 }, { +1, +1, +1 } },
@@ -217,99 +387,266 @@ GLuint Cube::makeCube(bool selectCube, bool transparent, PlayerCube p)
 	         { { +1, -1, +1 }, { -1, -1, +1 }, { -1, -1, -1 }, { +1, -1, -1 } },
 	         { { -1, -1, +1 }, { +1, -1, +1 }, { +1, +1, +1 }, { -1, +1, +1 } }
      	};
+	GLfloat vertices[MeshVertices][3];
+
+	for (int i = 0; i < 6; i++)
+		for (int j = 0; j < 4; j++)
+			for (int k = 0; k < 3; k++)
+			{
+				vertices[MeshLines + 4 * i + j][k]	= 0.2f * coords[i][j][k];
+				vertices[MeshQuads + 4 * i + j][k]	= 0.195f * coords[i][j][k];
+				if (j < 3)
+				{	// strip j..j + 1 as a line
+					vertices[MeshSegments + 6 * i + 2 * j][k]	= 0.2f * coords[i][j][k];
+					vertices[MeshSegments + 6 * i + 2 * j + 1][k]	= 0.2f * coords[i][j + 1][k];
+				}
+			}
 
-	int alpha	= transparent? 100 : 255;
+	if (!m_mesh.isCreated())
+		m_mesh.create();
+	m_mesh.bind();
+	m_mesh.setUsagePattern(QGLBuffer::StaticDraw);
+	m_mesh.allocate(vertices, sizeof(vertices));
+	m_mesh.release();
+}
+
+/*
+	Set up the instanced renderer: it needs GLSL and instanced arrays
+		(GL 3.3, or the ARB_draw_instanced and ARB_instanced_arrays extensions).
+	Without them, or if the shaders do not build, m_program stays 0
+		and paintGL draws cell by cell.
+*/
+void Cube::makeProgram()
+{
+	delete m_program;
+	m_program	= 0;
+
+	const char *version	= (const char *)glGetString(GL_VERSION);
+	const char *extensions	= (const char *)glGetString(GL_EXTENSIONS);
+	bool instancing		= (version && (atof(version) >= 3.3)) || (extensions &&
+		strstr(extensions, "GL_ARB_draw_instanced") && strstr(extensions, "GL_ARB_instanced_arrays"));
+	if (!instancing || !QGLShaderProgram::hasOpenGLShaderPrograms(context()))
+		return;
+
+	m_drawArraysInstanced	= (DrawArraysInstanced)context()->getProcAddress("glDrawArraysInstanced");
+	if (!m_drawArraysInstanced)
+		m_drawArraysInstanced	= (DrawArraysInstanced)context()->getProcAddress("glDrawArraysInstancedARB");
+	m_vertexAttribDivisor	= (VertexAttribDivisor)context()->getProcAddress("glVertexAttribDivisor");
+	if (!m_vertexAttribDivisor)
+		m_vertexAttribDivisor	= (VertexAttribDivisor)context()->getProcAddress("glVertexAttribDivisorARB");
+	if (!m_drawArraysInstanced || !m_vertexAttribDivisor)
+		return;
+
+	QGLShaderProgram *program = new QGLShaderProgram(context(), this);
+	program		->bindAttributeLocation("vertex", 0);	// attribute 0 must not be instanced
+	if (!program->addShaderFromSourceCode(QGLShader::Vertex, vertexShader) ||
+		!program->addShaderFromSourceCode(QGLShader::Fragment, fragmentShader) || !program->link())
+	{
+		delete program;
+		return;
+	}
 
-    	m_maxCube.setAlpha(alpha);
-    	m_minCube.setAlpha(alpha);
-    	m_blankCube.setAlpha(alpha);
+	m_program		= program;
+	m_vertexAttribute	= m_program->attributeLocation("vertex");
+	m_offsetAttribute	= m_program->attributeLocation("offset");
+	m_colorAttribute	= m_program->attributeLocation("color");
+
+	if (!m_instances.isCreated())
+		m_instances.create();
+	m_instances.bind();
+	m_instances.setUsagePattern(QGLBuffer::DynamicDraw);
+	m_instances.allocate(m_cells, sizeof(m_cells));
+	m_instances.release();
+	m_dirtyFirst	= MaxSize * MaxSize * MaxSize;
+	m_dirtyLast	= 0;
+}
 
-    	switch (p)
+/*
+	How the cell at x, y, z looks, based on 3 parameters (selected, active, who owns it):
+	If a cube is selected, it will paint a red border.
+	If a cube is active (on the layer of the cursor), it will paint with no transparency.
+	If a cube is owned, it will paint the appropriate color.
+*/
+void Cube::makeInstance(int x, int y, int z, Instance *cell)
+{
+	QColor cubeColor, lineColor;
+	double center	= (m_size - 1) / 2.0;
+
+    	switch (markedField[x][y][z])
     	{
 		case Blank:
-			m_cubeColor = m_blankCube;
+			cubeColor = m_blankCube;
 			break;
 		case MaxCube:
-			m_cubeColor = m_maxCube;
+			cubeColor = m_maxCube;
 			break;
 		case MinCube:
-			m_cubeColor = m_minCube;
+			cubeColor = m_minCube;
 			break;
 	}
+	cubeColor.setAlpha(z == currZ ? 255 : 100);
+	lineColor	= (x == currX && y == currY && z == currZ) ? Qt::red : Qt::black;
+
+	cell->offset[0]	= x - center;
+	cell->offset[1]	= y - center;
+	cell->offset[2]	= z - center;
+	cell->color[0]	= cubeColor.red();
+	cell->color[1]	= cubeColor.green();
+	cell->color[2]	= cubeColor.blue();
+	cell->color[3]	= cubeColor.alpha();
+	cell->outline[0]	= lineColor.red();
+	cell->outline[1]	= lineColor.green();
+	cell->outline[2]	= lineColor.blue();
+	cell->outline[3]	= 255;
+}
 
-     	GLuint list	= glGenLists(1);
-     	glNewList(list, GL_COMPILE);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+/*
+	Draw one cell from the mesh; the vertex buffer is bound by paintGL.
+*/
+void Cube::drawCube(const Instance &cell)
+{
+	glPushMatrix();
+	glTranslatef(cell.offset[0], cell.offset[1], cell.offset[2]);
+	glScaled(1.4, 1.4, 1.4);
 
-	if (selectCube)
-	{
-		glLineWidth(2.0);
-		m_lineColor = Qt::red;
-	}
-	else
-	{
-		glLineWidth(1.0);
-		m_lineColor = Qt::black;
-	}
+	glLineWidth(cell.outline[0] ? 2.0 : 1.0);	// the cursor's is red, the others black
+	glColor4ubv(cell.outline);
+	for (int i = 0; i < 6; i++)
+		glDrawArrays(GL_LINE_STRIP, MeshLines + 4 * i, 4);
 
-     	for (int i = 0; i < 6; i++)
-     	{
-		qglColor(m_lineColor);
-		glBegin(GL_LINE_STRIP);
-		for (int j = 0; j < 4; j++)
-		{
-			glTexCoord2d(j == 0 || j == 3, j == 0 || j == 1);
-			glVertex3d(0.2 * coords[i][j][0], 0.2 * coords[i][j][1], 0.2 * coords[i][j][2]);
-		}
-		glEnd();
-
-		qglColor(m_cubeColor);
-		glBegin(GL_QUADS);
-		glEdgeFlag(false);
-		for (int j = 0; j < 4; j++)
-		{
-			glTexCoord2d(j == 0 || j == 3, j == 0 || j == 1);
-			glVertex3d(0.195 * coords[i][j][0], 0.195 * coords[i][j][1], 0.195 * coords[i][j][2]);
-		}
-		glEnd();
+	glColor4ubv(cell.color);
+	glDrawArrays(GL_QUADS, MeshQuads, 24);
+	glPopMatrix();
+}
+
+/*
+	Draw the board with m_program, one instance per cell: the outlines of all cells,
+		the outline of the cursor again, wider, and the faces of all cells;
+		three draw calls whatever the size of the board.
+	The cells changed since the last frame are uploaded first, and only those.
+*/
+void Cube::drawInstanced()
+{
+	int count	= m_size * m_size * m_size;
+	int cursor	= (currX * m_size + currY) * m_size + currZ;
+
+	m_program	->bind();
+	m_mesh.bind();
+	m_program	->enableAttributeArray(m_vertexAttribute);
+	m_program	->setAttributeBuffer(m_vertexAttribute, GL_FLOAT, 0, 3);
+
+	m_instances.bind();
+	if (m_dirtyFirst < m_dirtyLast)
+	{
+		m_instances.write(m_dirtyFirst * sizeof(Instance), &m_cells[m_dirtyFirst],
+			(m_dirtyLast - m_dirtyFirst) * sizeof(Instance));
+		m_dirtyFirst	= MaxSize * MaxSize * MaxSize;
+		m_dirtyLast	= 0;
 	}
-	glEndList();
-	return list;
+	m_program	->enableAttributeArray(m_offsetAttribute);
+	m_program	->enableAttributeArray(m_colorAttribute);
+	m_vertexAttribDivisor(m_offsetAttribute, 1);
+	m_vertexAttribDivisor(m_colorAttribute, 1);
+
+	setInstanceAttributes(0, offsetof(Instance, outline));
+	glLineWidth(1.0);
+	m_drawArraysInstanced(GL_LINES, MeshSegments, 36, count);
+
+	setInstanceAttributes(cursor, offsetof(Instance, outline));
+	glLineWidth(2.0);
+	m_drawArraysInstanced(GL_LINES, MeshSegments, 36, 1);
+
+	setInstanceAttributes(0, offsetof(Instance, color));
+	m_drawArraysInstanced(GL_QUADS, MeshQuads, 24, count);
+
+	m_vertexAttribDivisor(m_offsetAttribute, 0);
+	m_vertexAttribDivisor(m_colorAttribute, 0);
+	m_program	->disableAttributeArray(m_colorAttribute);
+	m_program	->disableAttributeArray(m_offsetAttribute);
+	m_program	->disableAttributeArray(m_vertexAttribute);
+	m_instances.release();
+	m_program	->release();
 }
 
 /*
-	Draw all the cubes based on the "specification" list.
+	Point the per-cell attributes of m_program at m_cells[first] and on,
+		the colour at the field colorField of Instance (color or outline).
+	m_instances must be bound.
 */
-void Cube::drawCube(GLuint cube, GLdouble dx, GLdouble dy, GLdouble dz)
+void Cube::setInstanceAttributes(int first, int colorField)
 {
-	glPushMatrix();
-	glTranslated(dx, dy, dz);
-	glScaled(1.4, 1.4, 1.4);
-	glCallList(cube);
-	glPopMatrix();
+	int start	= first * sizeof(Instance);
+	m_program	->setAttributeBuffer(m_offsetAttribute, GL_FLOAT, start, 3, sizeof(Instance));
+	m_program	->setAttributeBuffer(m_colorAttribute, GL_UNSIGNED_BYTE, start + colorField, 4, sizeof(Instance));
 }
 
 /*
-	Every times a cube has changed,
-		it will generate a new cube with new parameter to reflect the current state of the game.
+	Every times the game or the cursor has changed, bring the cells up to date;
+		only the cells that look different are rewritten, and only then is a repaint asked for.
+	The range of cells rewritten is kept for the next upload to m_instances.
 */
 void Cube::updateCube()
 {
-	for (int x = 0; x < 3; x++)
-		for (int y = 0; y < 3; y++)
-			for (int z = 0; z < 3; z++)
+	int changed = 0;
+	for (int x = 0; x < m_size; x++)
+		for (int y = 0; y < m_size; y++)
+			for (int z = 0; z < m_size; z++)
 			{
-				if(z == currZ)
+				Instance cell;
+				makeInstance(x, y, z, &cell);
+
+				int i		= (x * m_size + y) * m_size + z;
+				if (memcmp(&cell, &m_cells[i], sizeof(Instance)))
 				{
-					if (x == currX && y == currY)
-						cubeObj[x][y][z] = makeCube(true, false, markedField[x][y][z]);
-					else
-						cubeObj[x][y][z] = makeCube(false, false, markedField[x][y][z]);
+					m_cells[i]	= cell;
+					m_dirtyFirst	= qMin(m_dirtyFirst, i);
+					m_dirtyLast	= qMax(m_dirtyLast, i + 1);
+					changed++;
 				}
-				else
-					cubeObj[x][y][z] = makeCube(false, true, markedField[x][y][z]);
 			}
-	updateGL();
+	if (changed)
+	{
+		m_stale	= true;
+		scheduleRepaint();
+	}
+}
+
+/*
+	Ask for a repaint. However many come in, the cube is painted once per frame:
+		the first request starts m_frameTimer, to fire FrameMsecs after the last frame
+		(at once if that is past), and the others wait for it.
+	A mouse drag thus costs at most one paintGL per frame, not one per event,
+		and leaves the rest of the processor to the engine thread.
+*/
+void Cube::scheduleRepaint()
+{
+	if (m_frameTimer.isActive())
+	{
+		m_frameStats.skipped++;
+		return;
+	}
+
+	int wait	= m_lastFrame.isValid() ? FrameMsecs - (int)m_lastFrame.elapsed() : 0;
+	m_frameTimer.start(qMax(0, wait), this);
+}
+
+/*
+	Protected function
+	the frame is due: repaint, unless the view and the cells are back to what was painted last.
+*/
+void Cube::timerEvent(QTimerEvent *e)
+{
+	if (e->timerId() != m_frameTimer.timerId())
+	{
+		QGLWidget::timerEvent(e);
+		return;
+	}
+
+	m_frameTimer.stop();
+	if (!m_stale && (xRot == m_paintedRot[0]) && (yRot == m_paintedRot[1]) && (zRot == m_paintedRot[2]))
+		m_frameStats.dropped++;
+	else
+		updateGL();
 }
 
 /*
@@ -322,7 +659,7 @@ void Cube::setXRotation(int angle)
 	if (angle != xRot)
 	{
 		xRot = angle;
-		updateGL();
+		scheduleRepaint();
 	}
 }
 
@@ -336,7 +673,7 @@ void Cube::setYRotation(int angle)
 	if (angle != yRot)
 	{
 		yRot = angle;
-		updateGL();
+		scheduleRepaint();
 	}
 }
 
@@ -350,7 +687,7 @@ void Cube::setZRotation(int angle)
 	if (angle != zRot)
 	{
 		zRot = angle;
-		updateGL();
+		scheduleRepaint();
 	}
 }
 
@@ -373,6 +710,104 @@ void Cube::normalizeAngle(int *angle)
 void Cube::mousePressEvent(QMouseEvent *e)
 {
 	lastPos = e->pos();
+	m_pressPos = e->pos();
+}
+
+/*
+	Protected function
+	a left click, the mouse not moved more than ClickPixels, marks the cell under it:
+	the cursor goes to the cell and marked is emitted, as with the spacebar.
+	Like the keys, a click only counts while the cube has grabbed the keyboard:
+		ViewBoard releases it while the computer moves and once the game is over.
+*/
+void Cube::mouseReleaseEvent(QMouseEvent *e)
+{
+	if ((keyboardGrabber() != this) || (e->button() != Qt::LeftButton) ||
+		(qAbs(e->x() - m_pressPos.x()) + qAbs(e->y() - m_pressPos.y()) > ClickPixels))
+		return;
+
+	int square = pickCell(e->pos());
+	if (square < 0)
+		return;
+
+	setAxis(square / (m_size * m_size), square / m_size % m_size, square % m_size);
+	emit marked(square);
+}
+
+/*
+	The cell under the widget point pos, as a square index, or -1 if there is none.
+	The ray from the eye through pos is taken back through the view of drawBoard and resizeGL
+		(the frustum, the translation, the rotations and the scale, undone in turn)
+		into board coordinates, and tested against the box of every cell by the slab method.
+		This is plain arithmetic; the GL is not asked, so the pipeline is not stalled.
+	Of the cells hit, the nearest one in the current layer wins, as that layer is the opaque one;
+		if the ray misses that layer, the nearest cell of any layer.
+*/
+int Cube::pickCell(const QPoint &pos)
+{
+	int side	= qMin(width(), height());
+	if (side <= 0)
+		return -1;
+
+	// the eye, and the point of pos on the near plane of glFrustum(-1, 1, -1, 1, 5, 60)
+	double origin[3]	= {0.0, 0.0, 12.0};	// glTranslated(0, 0, -12) undone
+	double direction[3]	= {
+		2.0 * (pos.x() + 0.5 - (width() - side) / 2) / side - 1.0,
+		1.0 - 2.0 * (pos.y() + 0.5 - (height() - side) / 2) / side,
+		-5.0};
+	double angles[3]	= {xRot / 16.0, yRot / 16.0, zRot / 16.0};
+	for (int axis = 0; axis < 3; axis++)
+	{
+		rotate(origin, axis, -angles[axis]);
+		rotate(direction, axis, -angles[axis]);
+	}
+	for (int k = 0; k < 3; k++)
+	{	// the board is scaled by 3 / m_size
+		origin[k]	*= m_size / 3.0;
+		direction[k]	*= m_size / 3.0;
+	}
+
+	double center	= (m_size - 1) / 2.0;
+	double half	= 0.2 * 1.4;		// of a cell: the mesh, scaled as drawCube does
+	int best	= -1;
+	bool bestLayer	= false;
+	double bestNear	= 0.0;
+
+	for (int x = 0; x < m_size; x++)
+		for (int y = 0; y < m_size; y++)
+			for (int z = 0; z < m_size; z++)
+			{
+				int cell[3]	= {x, y, z};
+				double near	= 0.0;
+				double far	= HUGE_VAL;
+
+				for (int k = 0; (k < 3) && (near <= far); k++)
+				{	// the part of the ray between the two planes of the box across axis k
+					double low	= cell[k] - center - half - origin[k];
+					double high	= cell[k] - center + half - origin[k];
+					if (direction[k] == 0.0)
+					{
+						if ((low > 0.0) || (high < 0.0))
+							far	= -1.0;
+						continue;
+					}
+					double t1	= low / direction[k];
+					double t2	= high / direction[k];
+					near	= qMax(near, qMin(t1, t2));
+					far	= qMin(far, qMax(t1, t2));
+				}
+				if (near > far)
+					continue;
+
+				bool layer	= z == currZ;
+				if ((best < 0) || (layer && !bestLayer) || ((layer == bestLayer) && (near < bestNear)))
+				{
+					best		= (x * m_size + y) * m_size + z;
+					bestLayer	= layer;
+					bestNear	= near;
+				}
+			}
+	return best;
 }
 
 /*
@@ -425,5 +860,5 @@ void Cube::keyPressEvent(QKeyEvent *e)
 
 	// Marking a field
 	if (e->key() == Qt::Key_Space)
-		emit marked(currX*9 + currY*3 + currZ);
+		emit marked((currX*m_size + currY)*m_size + currZ);
 }
@@ -6,11 +6,25 @@
 	CLASS:		Cube
 	DETAILS:	Visualize the 3D Tic Tac Toe cube.
 			Inherits from QGLWidget, which is OpenGL
+			Every cell is drawn from one cube mesh kept in a vertex buffer;
+			what differs from cell to cell is kept in m_cells.
+			Where the GL has shaders and instancing, the whole board is drawn
+			with a few instanced draw calls whatever its size (see paintGL);
+			elsewhere cell by cell with the fixed-function pipeline.
+			Changes of the view or the cells do not repaint at once: they ask for
+			a frame, and the frames are at least FrameMsecs apart (see scheduleRepaint).
+			renderImage draws the board into a framebuffer object instead of the window,
+			so board images can be made without showing the widget.
+			A click picks the cell under the mouse by casting a ray into the board
+			(see pickCell); a drag rotates the view.
 */
 #ifndef			CUBE_H
 #define			CUBE_H
 
 #include		<QtOpenGL>
+#include		<QGLBuffer>
+#include		<QGLShaderProgram>
+#include		<QGLFramebufferObject>
 
 class Cube : public QGLWidget
 {
@@ -20,12 +34,27 @@ public:
 			Cube		(QWidget *p = 0, QGLWidget *shareWidget = 0);
 			~Cube		();
 	enum		PlayerCube	{Blank, MaxCube, MinCube};
+	enum				{MaxSize = 5, FrameMsecs = 16, ClickPixels = 3};
+	struct		FrameStats		// of the repaints, for profiling
+	{
+		int		frames;		// paintGL calls
+		int		skipped;	// repaints asked for while one was already due
+		int		dropped;	// frames due with nothing left to change
+		qint64		paintNsecs;	// time spent in paintGL, all frames
+		qint64		worstNsecs;	// in the slowest frame
+	};
+	void		setSize		(int);
+	int		size		();
 	void		changeXAxis	(int);
 	void		changeYAxis	(int);
 	void		changeZAxis	(int);
 	void		setAxis		(int, int, int);
+	void		setRotation	(int, int, int);
 	bool		markCube	(PlayerCube);
 	void		reset		();
+	const FrameStats &frameStats	() const;
+	void		resetFrameStats	();
+	QImage		renderImage	(int);
 
 signals:
 	void		marked		(int);
@@ -36,21 +65,63 @@ protected:
 	void		resizeGL	(int, int);
 	void 		mousePressEvent	(QMouseEvent*);
 	void		mouseMoveEvent	(QMouseEvent*);
+	void		mouseReleaseEvent	(QMouseEvent*);
 	void		keyPressEvent	(QKeyEvent*);
+	void		timerEvent	(QTimerEvent*);
 
 private:
-	GLuint		makeCube	(bool, bool, PlayerCube);
-	void		drawCube	(GLuint, GLdouble, GLdouble, GLdouble);
+	enum				{MeshLines = 0, MeshQuads = 24, MeshSegments = 48, MeshVertices = 84};
+	typedef void	(APIENTRY *DrawArraysInstanced)	(GLenum, GLint, GLsizei, GLsizei);
+	typedef void	(APIENTRY *VertexAttribDivisor)	(GLuint, GLuint);
+	struct		Instance		// one cell, as drawn
+	{
+		GLfloat		offset[3];	// center, the board centered on the origin
+		GLubyte		color[4];	// of the faces; translucent off the current layer
+		GLubyte		outline[4];	// of the edges; red (and wider) for the cursor
+	};
+
+	void		makeMesh	();
+	void		makeProgram	();
+	void		makeInstance	(int, int, int, Instance *);
+	void		drawBoard	();
+	void		drawCube	(const Instance &);
+	void		drawInstanced	();
+	void		setInstanceAttributes	(int, int);
 	void		updateCube	();
+	void		scheduleRepaint	();
+	int		pickCell	(const QPoint &);
 
 	void 		normalizeAngle	(int*);
 	void 		setXRotation	(int);
 	void 		setYRotation	(int);
      	void 		setZRotation	(int);
 
-	GLuint 		cubeObj[3][3][3];
+	QGLBuffer	m_mesh;			// the edges (MeshLines as strips, MeshSegments as lines)
+						// and the faces (MeshQuads) of a cell
+	Instance	m_cells[MaxSize * MaxSize * MaxSize];	// square order, m_size^3 of them
+
+	QGLShaderProgram *m_program;		// the instanced renderer; 0 for the fixed-function one
+	QGLBuffer	m_instances;		// m_cells on the GPU, for m_program
+	int		m_dirtyFirst;		// m_cells[m_dirtyFirst] up to m_dirtyLast (excluded)
+	int		m_dirtyLast;		// have changed since the last upload to m_instances
+	int		m_vertexAttribute;	// attribute locations of m_program
+	int		m_offsetAttribute;
+	int		m_colorAttribute;
+	DrawArraysInstanced m_drawArraysInstanced;
+	VertexAttribDivisor m_vertexAttribDivisor;
+
+	bool		m_initialized;		// initializeGL has run
+	QGLFramebufferObject *m_snapshot;	// target of renderImage, kept for the next image
+
+	QBasicTimer	m_frameTimer;		// runs while a repaint is due
+	QElapsedTimer	m_lastFrame;		// since the last paintGL
+	bool		m_stale;		// m_cells changed since the last paintGL
+	int		m_paintedRot[3];	// xRot, yRot and zRot of the last paintGL
+	FrameStats	m_frameStats;
+
+	PlayerCube	markedField[MaxSize][MaxSize][MaxSize];
 
-	PlayerCube	markedField[3][3][3];
+	int		m_size;			// squares along each edge of the board
 
 	int		currX;
 	int		currY;
@@ -60,6 +131,7 @@ private:
 	int 		yRot;
 	int 		zRot;
 	QPoint 		lastPos;
+	QPoint		m_pressPos;		// where the mouse button went down; a click if it comes up near it
 
 	QColor		m_maxCube;
 	QColor		m_minCube;
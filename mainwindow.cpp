@@ -89,9 +89,29 @@ void MainWindow::endGame()
 	m_widMain	->setCurrentWidget(m_widDefault);
 }
 
+/*
+	Menu action
+	Board size of the games started from now on.
+*/
+void MainWindow::changeSize(QAction *action)
+{
+	m_viewBoard	->setBoardSize(action->data().toInt());
+}
+
+/*
+	Menu action
+	Algorithm the computer plays the games started from now on with.
+*/
+void MainWindow::changeAlgorithm(QAction *action)
+{
+	m_viewBoard	->setAlgorithm(action->data().toInt());
+}
+
 /*
 	Menu actions
 	Initialization.
+	One board size for every size the engine plays, 3x3x3 checked;
+		negamax or Monte Carlo tree search for the computer, negamax checked.
 */
 void MainWindow::createActions()
 {
@@ -102,11 +122,31 @@ void MainWindow::createActions()
 	m_quit		= new QAction(tr("E&xit"), this);
 	m_quit		->setShortcut(tr("Ctrl+Q"));
 
+	m_sizes		= new QActionGroup(this);
+	for (int size = TTT3D_MIN_SIZE; size <= TTT3D_MAX_SIZE; size++)
+	{
+		QAction *action	= m_sizes->addAction(tr("%1x%1x%1").arg(size));
+		action		->setData(size);
+		action		->setCheckable(true);
+		action		->setChecked(size == 3);
+	}
+
+	m_algorithms	= new QActionGroup(this);
+	QAction *negamax	= m_algorithms->addAction(tr("Negamax search"));
+	negamax		->setData(TTT3DEngine::Negamax);
+	negamax		->setCheckable(true);
+	negamax		->setChecked(true);
+	QAction *mcts	= m_algorithms->addAction(tr("Monte Carlo tree search"));
+	mcts		->setData(TTT3DEngine::MonteCarlo);
+	mcts		->setCheckable(true);
+
 	connect(m_Hfirst,	SIGNAL(triggered()), this, SLOT(Hfirst()));
 	connect(m_Cfirst,	SIGNAL(triggered()), this, SLOT(Cfirst()));
 	connect(m_HvsH,		SIGNAL(triggered()), this, SLOT(HvsH()));
 	connect(m_CvsC,		SIGNAL(triggered()), this, SLOT(CvsC()));
 	connect(m_quit,		SIGNAL(triggered()), qApp, SLOT(quit()));
+	connect(m_sizes,	SIGNAL(triggered(QAction *)), this, SLOT(changeSize(QAction *)));
+	connect(m_algorithms,	SIGNAL(triggered(QAction *)), this, SLOT(changeAlgorithm(QAction *)));
 }
 
 /*
@@ -119,11 +159,20 @@ void MainWindow::createMenus()
 	m_menuHvsC	->addAction(m_Hfirst);
 	m_menuHvsC	->addAction(m_Cfirst);
 
+	m_menuSize	= new QMenu(tr("Board size"), this);
+	m_menuSize	->addActions(m_sizes->actions());
+
+	m_menuAlgorithm	= new QMenu(tr("Computer player"), this);
+	m_menuAlgorithm	->addActions(m_algorithms->actions());
+
 	m_menuGame	= new QMenu(tr("&Game"), this);
 	m_menuGame	->addMenu(m_menuHvsC);
 	m_menuGame	->addAction(m_HvsH);
 	m_menuGame	->addAction(m_CvsC);
 	m_menuGame	->addSeparator();
+	m_menuGame	->addMenu(m_menuSize);
+	m_menuGame	->addMenu(m_menuAlgorithm);
+	m_menuGame	->addSeparator();
 	m_menuGame	->addAction(m_quit);
 
 	menuBar()	->addMenu(m_menuGame);
@@ -24,6 +24,8 @@ private slots:
 	void		HvsH();
 	void		CvsC();
 	void		endGame();
+	void		changeSize(QAction *);
+	void		changeAlgorithm(QAction *);
 
 private:
 	void		createActions();
@@ -31,12 +33,16 @@ private:
 
 	QMenu		*m_menuGame;
 	QMenu		*m_menuHvsC;
+	QMenu		*m_menuSize;
+	QMenu		*m_menuAlgorithm;
 
 	QAction		*m_Hfirst;
 	QAction		*m_Cfirst;
 	QAction		*m_HvsH;
 	QAction		*m_CvsC;
 	QAction		*m_quit;
+	QActionGroup	*m_sizes;
+	QActionGroup	*m_algorithms;
 
 	QStackedWidget 	*m_widMain;
 	QWidget		*m_widDefault;
@@ -0,0 +1,487 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dbench.cpp
+	DETAILS:	ttt3d-bench, speed of the search on a fixed set of positions.
+			A console program of its own, built from ttt3dbench.cpp, ttt3dsearch.cpp
+			and ttt3deval.cpp; it needs no Qt.
+
+			Usage: ttt3d-bench [--perft | --eval | --report] [-d depth] [-m msecs] [-p board]
+				--perft	count positions instead of searching (see below)
+				--eval	time the batch evaluator instead of searching (see below)
+				--report	check the root moves of cut-short searches (see below)
+				-d	deepest fixed-depth search (default 8)
+				-m	minimum time per measurement in milliseconds (default 100)
+				-p	benchmark this board instead of the built-in set
+
+	Every position is searched single-threaded to each depth from 1 to depth,
+		starting from an empty transposition table and without any budget,
+		so the node counts are the same on every run and only the time varies.
+	A search is repeated until it has taken at least msecs in total;
+		the reported time is the average of one search, clearing the table excluded.
+
+	Output is CSV, one line per position and depth, then a total line:
+		name,stones,depth,reached,move,score,nodes,usec,nps,tt_probes,tt_hits,tt_hit_rate
+	reached is less than depth when the game was solved before that depth.
+
+	With --perft, TTT3DSearch::perft walks every move sequence of each depth instead
+		and the numbers of positions still being played, won by either player and drawn
+		are checked against the known-good counts below; a perft timing is not repeated.
+		name,depth,ongoing,wins1,wins2,draws,positions,usec,positions_per_sec,check
+	positions counts every position the walk made a move into, at every depth up to depth.
+	check is ok or FAIL, or - for depths without a known count; any FAIL exits with 1.
+	By default every known depth is walked; -d limits the depth.
+	(Draws stay 0: a full 3x3x3 board always holds a line.)
+
+	With --eval, TTT3DBatchEval counts the lines of a batch of positions taken from
+		random games, once with each kernel the processor has:
+		kernel,positions,usec,positions_per_sec,check
+	check is ok when the kernel gives the same counts as the scalar one, FAIL otherwise;
+		any FAIL exits with 1. -m applies as for the searches.
+
+	With --report, every position (and a few 4x4x4 ones) is searched to node budgets that
+		run out in the middle of an iteration, and the root moves of TTT3DReport are checked:
+		name,size,budget,depth,move,score,root_score,check
+	root_score is what the report gives the move played; check is ok when it is the score
+		the search returned, FAIL otherwise (any FAIL exits with 1), - when not even
+		one iteration completed.
+
+	Whatever the mode, every heap allocation of the program is counted (operator new is
+		replaced below), and a search or a perft that allocates at all makes the benchmark
+		say so on stderr and exit with 1: the search keeps everything it needs in
+		fixed-size arrays of TTT3DSearchN and on the stack, and must stay that way.
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <vector>
+#include "ttt3deval.h"
+#include "ttt3dreport.h"
+#include "ttt3dsearch.h"
+
+/*
+	Heap allocations so far; operator new and new[] count them in allocate,
+		and the plain, sized and array deletes all free through release.
+*/
+static std::atomic<int64_t> allocations(0);
+
+static void *allocate(size_t size)
+{
+	allocations++;
+	void *memory = malloc(size ? size : 1);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+
+static void release(void *memory) noexcept
+{
+	free(memory);
+}
+
+void *operator new(size_t size)
+{
+	return allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+	return allocate(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+	release(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+	release(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+	release(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept
+{
+	release(memory);
+}
+
+/*
+	Complain if what was measured allocated since before, allocations at the time.
+	Return false if it did.
+*/
+static bool checkAllocations(int64_t before, const char *what, const char *name, int depth)
+{
+	int64_t count = allocations - before;
+	if (count)
+		fprintf(stderr, "ttt3d-bench: %s of %s to depth %d allocated %lld times\n", what, name, depth, (long long)count);
+	return count == 0;
+}
+
+/*
+	Positions in the notation of TTT3DSearch::setBoard, square order as in ttt3dsearch.h.
+	The openings and middle games have no open line of two yet;
+		the late positions are decided within a few plies.
+*/
+static const struct
+{
+	const char	*name;
+	const char	*board;
+} positions[] = {
+	{"empty",	"..........................."},
+	{"center",	".............x............."},
+	{"corner",	"x.........................."},
+	{"edge",	".........x................."},
+	{"opening-2",	".............x..o.........."},
+	{"opening-3",	"..............o..x.x......."},
+	{"opening-4",	"..........o.....x..x......o"},
+	{"opening-5",	"....o..........o.x..x....x."},
+	{"middle-6",	"x..o......o.....x.....ox..."},
+	{"middle-7",	"..ox.....x...o...o.....xx.."},
+	{"middle-8",	"..xx...o.o....ox...x.o....."},
+	{"middle-9",	".xoo.....x....xox....xo...."},
+	{"middle-10",	"..xo...x.x.o....o.o.xx...o."},
+	{"late-12",	".xx.xx.....x.oo.xo....o.o.o"},
+	{"late-16",	".x.x.o.oxo.ooxxxo..xo..ox.."},
+	{"late-20",	"x.xo.ooxooo.xoo..xxoxxo..xx"}
+};
+
+/*
+	Known-good perft counts: positions ongoing, won by player 1, won by player 2, drawn,
+		depth plies ahead of the named position.
+*/
+static const struct
+{
+	const char	*name;
+	int		depth;
+	int64_t		counts[4];
+} perftCounts[] = {
+	{"empty",	1, {27, 0, 0, 0}},
+	{"empty",	2, {702, 0, 0, 0}},
+	{"empty",	3, {17550, 0, 0, 0}},
+	{"empty",	4, {421200, 0, 0, 0}},
+	{"empty",	5, {9525312, 162288, 0, 0}},
+	{"middle-10",	1, {17, 0, 0, 0}},
+	{"middle-10",	2, {272, 0, 0, 0}},
+	{"middle-10",	3, {3570, 510, 0, 0}},
+	{"middle-10",	4, {44408, 0, 5572, 0}},
+	{"middle-10",	5, {426648, 150656, 0, 0}},
+	{"middle-10",	6, {3913632, 0, 1206144, 0}},
+	{"late-16",	1, {6, 5, 0, 0}},
+	{"late-16",	2, {37, 0, 23, 0}},
+	{"late-16",	3, {116, 217, 0, 0}},
+	{"late-16",	4, {412, 0, 516, 0}},
+	{"late-16",	5, {468, 2416, 0, 0}},
+	{"late-16",	6, {648, 0, 2160, 0}},
+	{"late-16",	7, {0, 3240, 0, 0}},
+	{"late-20",	1, {2, 5, 0, 0}},
+	{"late-20",	2, {3, 0, 9, 0}},
+	{"late-20",	3, {2, 13, 0, 0}},
+	{"late-20",	4, {0, 0, 8, 0}}
+};
+
+/*
+	Perft of board to each depth from 1 to maxDepth; name selects the known-good counts.
+	Return false if a count is wrong.
+*/
+static bool perft(TTT3DSearch *search, const char *name, const char *board, int maxDepth)
+{
+	bool ok = true;
+	search->setBoard(board);
+
+	for (int depth = 1; depth <= maxDepth; depth++)
+	{
+		int64_t counts[27][4];
+		memset(counts, 0, sizeof(counts));
+
+		int64_t before	= allocations;
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		search->perft(depth, counts);
+		double usecs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		ok	= checkAllocations(before, "perft", name, depth) && ok;
+
+		int64_t positions = 0;
+		for (int d = 0; d < depth; d++)
+			positions	+= counts[d][0] + counts[d][1] + counts[d][2] + counts[d][3];
+
+		const char *check = "-";
+		for (size_t i = 0; i < sizeof(perftCounts) / sizeof(perftCounts[0]); i++)
+			if ((strcmp(perftCounts[i].name, name) == 0) && (perftCounts[i].depth == depth))
+			{
+				check	= memcmp(perftCounts[i].counts, counts[depth - 1], sizeof(counts[0])) ? "FAIL" : "ok";
+				if (check[0] == 'F')
+					ok	= false;
+			}
+
+		const int64_t *last = counts[depth - 1];
+		printf("%s,%d,%lld,%lld,%lld,%lld,%lld,%.2f,%.0f,%s\n", name, depth, (long long)last[0],
+			(long long)last[1], (long long)last[2], (long long)last[3], (long long)positions,
+			usecs, usecs > 0 ? positions / usecs * 1e6 : 0.0, check);
+		fflush(stdout);
+	}
+	return ok;
+}
+
+/*
+	Positions of the larger board for --report, in the notation of TTT3DSearchN<4>::setBoard.
+*/
+static const struct
+{
+	const char	*name;
+	const char	*board;
+} positions4[] = {
+	{"4-empty",	"................................................................"},
+	{"4-opening-2",	"xo.............................................................."},
+	{"4-opening-4",	".....x..........o.....x....................o...................."}
+};
+
+/*
+	Search board to budget nodes, which cuts the last iteration short, and check that the
+		root moves of the report give the move returned the score returned.
+	Return false if they do not.
+*/
+template <int N>
+static bool reportCheck(const char *name, const char *board, int64_t budget)
+{
+	TTT3DHashTable hashTable;
+	std::atomic<bool> stop(false);
+	TTT3DSearchN<N> search(&hashTable, &stop);
+	if (!search.setBoard(board) || search.getResult())
+	{
+		fprintf(stderr, "ttt3d-bench: %s is not a position of an ongoing game\n", name);
+		return false;
+	}
+
+	int score;
+	search.setBudget(0, budget);
+	search.setDepth(0);
+	int move = search.search(0, &score);
+
+	TTT3DReport report;
+	search.fillReport(&report);
+	int root = -1;
+	for (int i = 0; i < report.rootCount; i++)
+		if (report.rootMove[i] == move)
+			root	= i;
+
+	const char *check = !search.depth() ? "-" : (((root >= 0) && (report.rootScore[root] == score)) ? "ok" : "FAIL");
+	char rootScore[16] = "-";
+	if (root >= 0)
+		sprintf(rootScore, "%d", report.rootScore[root]);
+	printf("%s,%d,%lld,%d,%d,%d,%s,%s\n", name, N, (long long)budget, search.depth(), move, score, rootScore, check);
+	fflush(stdout);
+	return check[0] != 'F';
+}
+
+/*
+	Time every kernel of TTT3DBatchEval on positions of random games, player 1 counted,
+		and check it against the scalar kernel. Return false if one differs.
+*/
+static bool evalBench(TTT3DSearch *search, int minMsecs)
+{
+	const int count = 1 << 16;
+	std::vector<uint32_t> own(count), other(count);
+	std::mt19937 random(1);
+
+	for (int i = 0; i < count; i++)
+	{	// 1 to 26 random moves, stopping at the end of the game
+		search->reset();
+		int stones = 1 + random() % 26;
+		for (int s = 0; (s < stones) && !search->getResult(); s++)
+		{
+			int pos;
+			do
+				pos	= random() % 27;
+			while (((search->stones(1) | search->stones(2)) >> pos) & 1);
+			search->makeMove(pos, search->currentPlayer());
+		}
+		own[i]		= search->stones(1);
+		other[i]	= search->stones(2);
+	}
+
+	std::vector<uint8_t> reference(3 * count), counts(3 * count);
+	TTT3DBatchEval eval;
+	bool ok = true;
+
+	printf("kernel,positions,usec,positions_per_sec,check\n");
+	for (int kernel = TTT3DBatchEval::Scalar; kernel <= TTT3DBatchEval::bestKernel(); kernel++)
+	{
+		eval.setKernel(kernel);
+		std::vector<uint8_t> &out = (kernel == TTT3DBatchEval::Scalar) ? reference : counts;
+
+		int runs = 0;
+		double usecs = 0;
+		do
+		{
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			eval.evaluate(count, &own[0], &other[0], &out[0], &out[count], &out[2 * count]);
+			usecs	+= std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+			runs++;
+		}
+		while (usecs < minMsecs * 1000.0);
+		usecs	/= runs;
+
+		bool same	= (&out == &reference) || (counts == reference);
+		ok		= ok && same;
+		printf("%s,%d,%.2f,%.0f,%s\n", TTT3DBatchEval::kernelName(kernel), count, usecs,
+			count / usecs * 1e6, same ? "ok" : "FAIL");
+		fflush(stdout);
+	}
+	return ok;
+}
+
+int main(int argc, char *argv[])
+{
+	int maxDepth		= 0;
+	int minMsecs		= 100;
+	const char *board	= 0;
+	bool perftMode		= false;
+	bool evalMode		= false;
+	bool reportMode		= false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--perft") == 0)
+			perftMode	= true;
+		else if (strcmp(argv[i], "--eval") == 0)
+			evalMode	= true;
+		else if (strcmp(argv[i], "--report") == 0)
+			reportMode	= true;
+		else if ((strcmp(argv[i], "-d") == 0) && (i + 1 < argc))
+			maxDepth	= atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-m") == 0) && (i + 1 < argc))
+			minMsecs	= atoi(argv[++i]);
+		else if ((strcmp(argv[i], "-p") == 0) && (i + 1 < argc))
+			board		= argv[++i];
+		else
+		{
+			fprintf(stderr, "usage: ttt3d-bench [--perft | --eval | --report] [-d depth] [-m msecs] [-p board]\n");
+			return 2;
+		}
+	}
+
+	TTT3DHashTable hashTable;
+	std::atomic<bool> stop(false);
+	TTT3DSearch search(&hashTable, &stop);
+
+	if (evalMode)
+		return evalBench(&search, minMsecs) ? 0 : 1;
+
+	if (reportMode)
+	{
+		bool ok = true;
+		printf("name,size,budget,depth,move,score,root_score,check\n");
+		for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+			for (int64_t budget = 1000; budget <= 100000; budget *= 10)
+				ok	= reportCheck<3>(positions[p].name, positions[p].board, budget) && ok;
+		for (size_t p = 0; p < sizeof(positions4) / sizeof(positions4[0]); p++)
+			for (int64_t budget = 10000; budget <= 1000000; budget *= 10)
+				ok	= reportCheck<4>(positions4[p].name, positions4[p].board, budget) && ok;
+		return ok ? 0 : 1;
+	}
+
+	if (perftMode)
+	{
+		printf("name,depth,ongoing,wins1,wins2,draws,positions,usec,positions_per_sec,check\n");
+		if (board)
+		{
+			if (!search.setBoard(board) || search.getResult())
+			{
+				fprintf(stderr, "ttt3d-bench: custom is not a position of an ongoing game\n");
+				return 1;
+			}
+			return perft(&search, "custom", board, maxDepth ? maxDepth : 5) ? 0 : 1;
+		}
+
+		bool ok = true;
+		for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+		{
+			int known = 0;
+			for (size_t i = 0; i < sizeof(perftCounts) / sizeof(perftCounts[0]); i++)
+				if (strcmp(perftCounts[i].name, positions[p].name) == 0)
+					known	= perftCounts[i].depth;
+
+			if (known)
+				ok	= perft(&search, positions[p].name, positions[p].board, maxDepth ? std::min(maxDepth, known) : known) && ok;
+		}
+		return ok ? 0 : 1;
+	}
+
+	if (!maxDepth)
+		maxDepth	= 8;
+
+	int count = board ? 1 : sizeof(positions) / sizeof(positions[0]);
+	int64_t totalNodes	= 0;
+	int64_t totalProbes	= 0;
+	int64_t totalHits	= 0;
+	double totalUsecs	= 0;
+	bool allocationFree	= true;
+
+	printf("name,stones,depth,reached,move,score,nodes,usec,nps,tt_probes,tt_hits,tt_hit_rate\n");
+	for (int p = 0; p < count; p++)
+	{
+		const char *name	= board ? "custom" : positions[p].name;
+		const char *squares	= board ? board : positions[p].board;
+		if (!search.setBoard(squares))
+		{
+			fprintf(stderr, "ttt3d-bench: %s is not a position\n", name);
+			return 1;
+		}
+		if (search.getResult())
+		{
+			fprintf(stderr, "ttt3d-bench: the game of %s is over\n", name);
+			return 1;
+		}
+
+		int stones = 0;
+		for (int i = 0; i < 27; i++)
+			if ((squares[i] != '.') && (squares[i] != '-'))
+				stones++;
+
+		for (int depth = 1; depth <= maxDepth; depth++)
+		{
+			int move, score, runs = 0;
+			double usecs = 0;
+			search.setDepth(depth);
+
+			int64_t before	= allocations;
+			do
+			{	// clearing the table is not part of the measurement
+				hashTable.clear();
+				std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+				move	= search.search(0, &score);
+				usecs	+= std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+				runs++;
+			}
+			while (usecs < minMsecs * 1000.0);
+			usecs	/= runs;
+			allocationFree	= checkAllocations(before, "the search", name, depth) && allocationFree;
+
+			int64_t nodes	= search.nodes();
+			int64_t probes	= search.hashProbes();
+			int64_t hits	= search.hashHits();
+			printf("%s,%d,%d,%d,%d,%d,%lld,%.2f,%.0f,%lld,%lld,%.4f\n", name, stones, depth, search.depth(),
+				move, score, (long long)nodes, usecs, nodes / usecs * 1e6, (long long)probes, (long long)hits, probes ? (double)hits / probes : 0.0);
+			fflush(stdout);
+
+			totalNodes	+= nodes;
+			totalProbes	+= probes;
+			totalHits	+= hits;
+			totalUsecs	+= usecs;
+		}
+	}
+
+	printf("total,,,,,,%lld,%.2f,%.0f,%lld,%lld,%.4f\n", (long long)totalNodes, totalUsecs,
+		totalNodes / totalUsecs * 1e6, (long long)totalProbes, (long long)totalHits,
+		totalProbes ? (double)totalHits / totalProbes : 0.0);
+	return allocationFree ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dboard.h
+	CLASS:		TTT3DBoard
+	DETAILS:	Geometry of an NxNxN board: its winning lines, which lines go through
+			which square and the bitboard type wide enough for its squares.
+			Everything is computed by the compiler (constexpr), one table per N.
+			Part of the engine core, which only uses standard C++ (C++14) and no Qt.
+*/
+#ifndef			TTT3DBOARD_H
+#define			TTT3DBOARD_H
+
+#include		<stdint.h>
+
+/* board sizes
+	Each size gets the narrowest bitboard its squares fit in:
+		3x3x3 (27 squares) 32 bits, 4x4x4 (64 squares) 64 bits, 5x5x5 (125 squares) 128 bits.
+	128-bit integers are a compiler extension (GCC, Clang); without them
+		TTT3D_MAX_SIZE is 4.
+*/
+#define			TTT3D_MIN_SIZE		3
+#ifdef __SIZEOF_INT128__
+#define			TTT3D_MAX_SIZE		5
+__extension__ typedef unsigned __int128	TTT3DUint128;
+#else
+#define			TTT3D_MAX_SIZE		4
+#endif
+
+template <int Squares, bool Fits32 = (Squares <= 32), bool Fits64 = (Squares <= 64)>
+struct TTT3DBits;
+
+template <int Squares>
+struct TTT3DBits<Squares, true, true>
+{
+	typedef uint32_t	Type;
+};
+
+template <int Squares>
+struct TTT3DBits<Squares, false, true>
+{
+	typedef uint64_t	Type;
+};
+
+#ifdef __SIZEOF_INT128__
+template <int Squares>
+struct TTT3DBits<Squares, false, false>
+{
+	typedef TTT3DUint128	Type;
+};
+#endif
+
+/*
+	Square i sits at (x, y, z) = (i / (N * N), (i / N) % N, i % N), the grid Cube uses.
+	A line is N squares in a row along one of the 13 directions of the cube:
+		first the 3N^2 lines along the axes, then the 6N diagonals of the planes,
+		then the 4 diagonals of the whole cube; 49 lines for 3x3x3, 76 for 4x4x4.
+	No square is on more than 13 lines, one per direction.
+*/
+template <int N>
+struct TTT3DBoard
+{
+	enum				{Size = N, Squares = N * N * N, Lines = 3 * N * N + 6 * N + 4, MaxSquareLines = 13};
+	typedef typename TTT3DBits<Squares>::Type Bitboard;
+
+	int		line[Lines][N];		// squares of each line
+	Bitboard	lineMask[Lines];	// the same as bitboards; a side wins when it owns a whole mask
+	int		squareLines[Squares][MaxSquareLines];	// lines through each square,
+	int		squareLineCount[Squares];		// squareLineCount[i] of them
+	int		squareOrder[Squares];	// squares by the number of lines through them, most first
+	int		lineValue[N];		// heuristic value of a line only one side has played on
+
+	constexpr TTT3DBoard()
+		: line(), lineMask(), squareLines(), squareLineCount(), squareOrder(), lineValue()
+	{
+		int count = 0;
+		for (int span = 1; span <= 3; span++)		// nonzero components of the direction
+			for (int dx = -1; dx <= 1; dx++)
+				for (int dy = -1; dy <= 1; dy++)
+					for (int dz = 1; dz >= -1; dz--)
+					{
+						int first = dx ? dx : (dy ? dy : dz);
+						if ((first <= 0) || ((dx != 0) + (dy != 0) + (dz != 0) != span))
+							continue;		// every direction once, pointing forward
+
+						// a moving coordinate starts at the side it moves away from
+						int x0 = (dx < 0) ? N - 1 : 0,	x1 = dx ? x0 : N - 1;
+						int y0 = (dy < 0) ? N - 1 : 0,	y1 = dy ? y0 : N - 1;
+						int z0 = (dz < 0) ? N - 1 : 0,	z1 = dz ? z0 : N - 1;
+						for (int x = x0; x <= x1; x++)
+							for (int y = y0; y <= y1; y++)
+								for (int z = z0; z <= z1; z++)
+								{
+									for (int k = 0; k < N; k++)
+									{
+										int sq = (x + k * dx) * N * N + (y + k * dy) * N + (z + k * dz);
+										line[count][k]	= sq;
+										lineMask[count]	|= Bitboard(1) << sq;
+										squareLines[sq][squareLineCount[sq]++] = count;
+									}
+									count++;
+								}
+					}
+
+		int ordered = 0;
+		for (int lines = MaxSquareLines; lines > 0; lines--)
+			for (int sq = 0; sq < Squares; sq++)
+				if (squareLineCount[sq] == lines)
+					squareOrder[ordered++] = sq;
+
+		for (int squares = 1; squares < N; squares++)
+			lineValue[squares] = 1 << (2 * (squares - 1));	// 1, 4, 16, ...
+	}
+};
+
+static_assert(TTT3DBoard<3>().squareLineCount[13] == 13, "the center of 3x3x3 is on 13 lines");
+static_assert(TTT3DBoard<3>().squareLineCount[0] == 7, "a corner of 3x3x3 is on 7 lines");
+static_assert(TTT3DBoard<4>().squareLineCount[21] == 7, "an inner square of 4x4x4 is on 7 lines");
+static_assert(TTT3DBoard<4>().lineMask[TTT3DBoard<4>::Lines - 1] != 0, "every line of 4x4x4 is filled in");
+#endif
@@ -0,0 +1,55 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dbook.cpp
+	CLASS:		TTT3DBook
+	DETAILS:	Opening book: the solved move of every position of the first plies.
+*/
+#include "ttt3dbook.h"
+
+/*
+	Look up the position of search.
+	Binary search on the canonical code; the best move is turned back
+		into the orientation of the game.
+	Return false if the position is not in the book.
+*/
+bool TTT3DBook::lookup(TTT3DSearch *search, int *move, int *score)
+{
+	int sym;
+	uint64_t code	= search->canonicalCode(&sym);
+
+	int low		= 0;
+	int high	= m_count;
+	while (low < high)
+	{
+		int mid = (low + high) / 2;
+		if (m_entries[mid].code < code)
+			low	= mid + 1;
+		else
+			high	= mid;
+	}
+
+	if ((low == m_count) || (m_entries[low].code != code))
+		return false;
+
+	*move	= TTT3DSearch::fromCanonical(sym, m_entries[low].move);
+	*score	= m_entries[low].score;
+	return true;
+}
+
+/*
+	Every position with fewer stones than this is in the book.
+*/
+int TTT3DBook::plies()
+{
+	return m_plies;
+}
+
+/*
+	Number of positions in the book.
+*/
+int TTT3DBook::count()
+{
+	return m_count;
+}
@@ -0,0 +1,34 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dbook.h
+	CLASS:		TTT3DBook
+	DETAILS:	Opening book: the solved move of every position of the first plies.
+			The entries live in ttt3dbookdata.cpp, which ttt3dsolve --book generates.
+*/
+#ifndef			TTT3DBOOK_H
+#define			TTT3DBOOK_H
+
+#include		"ttt3dsearch.h"
+
+class TTT3DBook
+{
+public:
+	static bool	lookup		(TTT3DSearch *, int *, int *);
+	static int	plies		();
+	static int	count		();
+
+private:
+	struct		Entry
+	{
+		uint64_t	code;		// TTT3DSearch::canonicalCode
+		uint8_t		move;		// canonical orientation
+		int8_t		score;
+	};
+
+	static const Entry	m_entries[];	// sorted by code
+	static const int	m_count;
+	static const int	m_plies;	// positions with fewer stones than this are in the book
+};
+#endif
@@ -0,0 +1,949 @@
+/*
+	Generated by ttt3dsolve --book 5; do not edit.
+
+	FILE: 		ttt3dbookdata.cpp
+	CLASS:		TTT3DBook
+	DETAILS:	Solved move of every position with fewer than 5 stones,
+			{canonical code, canonical move, score}, sorted by code.
+*/
+#include "ttt3dbook.h"
+
+const int TTT3DBook::m_plies = 5;
+const int TTT3DBook::m_count = 2802;
+
+const TTT3DBook::Entry TTT3DBook::m_entries[] = {
+	{UINT64_C(0x00000000000000), 13,   93}, {UINT64_C(0x00000000000001), 13,   90}, {UINT64_C(0x00000000000002), 13,   90},
+	{UINT64_C(0x00000000000010), 13,   90}, {UINT64_C(0x00000000002000),  0,  -93}, {UINT64_C(0x00000008000002), 13,   93},
+	{UINT64_C(0x00000008000004),  8,   93}, {UINT64_C(0x00000008000006),  6,   92}, {UINT64_C(0x0000000800000a), 13,   92},
+	{UINT64_C(0x0000000800000c), 18,   92}, {UINT64_C(0x00000008000010), 13,   93}, {UINT64_C(0x00000008000012),  7,  -93},
+	{UINT64_C(0x00000008000014),  6,  -91}, {UINT64_C(0x00000008000020), 13,   93}, {UINT64_C(0x00000008000022), 13,   92},
+	{UINT64_C(0x00000008000024),  8,  -93}, {UINT64_C(0x00000008000028),  4,   92}, {UINT64_C(0x00000008000030),  3,  -89},
+	{UINT64_C(0x00000008000044),  4,  -93}, {UINT64_C(0x00000008000060),  2,   92}, {UINT64_C(0x000000080000a0), 13,   92},
+	{UINT64_C(0x00000008000100),  6,   93}, {UINT64_C(0x00000008000102),  6,   92}, {UINT64_C(0x00000008000104),  5,  -93},
+	{UINT64_C(0x00000008000110), 24,   92}, {UINT64_C(0x00000008000120),  2,   92}, {UINT64_C(0x00000008000210), 13,   92},
+	{UINT64_C(0x00000008000220), 13,   92}, {UINT64_C(0x00000008000300),  6,   92}, {UINT64_C(0x00000008000410), 13,   92},
+	{UINT64_C(0x00000008000420), 13,   92}, {UINT64_C(0x00000008000440),  8,   92}, {UINT64_C(0x00000008000480), 13,   92},
+	{UINT64_C(0x00000008000500),  6,   92}, {UINT64_C(0x00000008000820), 13,   92}, {UINT64_C(0x00000008000840),  2,   92},
+	{UINT64_C(0x00000008000880), 13,   92}, {UINT64_C(0x00000008000900),  2,   92}, {UINT64_C(0x00000008002000),  4,   93},
+	{UINT64_C(0x00000008002002), 25,  -93}, {UINT64_C(0x00000008002004), 24,  -91}, {UINT64_C(0x00000008002010), 22,  -93},
+	{UINT64_C(0x00000008002020), 21,  -93}, {UINT64_C(0x00000008002100), 18,  -91}, {UINT64_C(0x00000008004000),  2,   93},
+	{UINT64_C(0x00000008004002),  6,   92}, {UINT64_C(0x00000008004004), 26,  -93}, {UINT64_C(0x00000008004008),  2,   92},
+	{UINT64_C(0x00000008004010), 18,   92}, {UINT64_C(0x00000008004020), 23,  -93}, {UINT64_C(0x00000008004040),  2,   92},
+	{UINT64_C(0x00000008004080), 20,   92}, {UINT64_C(0x00000008004100), 20,   92}, {UINT64_C(0x00000008005000), 13,   92},
+	{UINT64_C(0x00000008006000), 12,  -89}, {UINT64_C(0x00000008008800), 13,   92}, {UINT64_C(0x0000000800c000),  2,   92},
+	{UINT64_C(0x00000008014000),  6,   92}, {UINT64_C(0x00000008020000), 16,   93}, {UINT64_C(0x00000008020002), 18,   92},
+	{UINT64_C(0x00000008020004), 18,   92}, {UINT64_C(0x00000008020010), 18,   92}, {UINT64_C(0x00000008020020),  2,   92},
+	{UINT64_C(0x00000008020100), 26,  -93}, {UINT64_C(0x00000008020200), 13,   92}, {UINT64_C(0x00000008020400),  6,   92},
+	{UINT64_C(0x00000008020800), 14,  -93}, {UINT64_C(0x00000008022000),  9,  -89}, {UINT64_C(0x00000008024000), 11,  -93},
+	{UINT64_C(0x00000008040100), 13,  -93}, {UINT64_C(0x00000008060000),  2,   92}, {UINT64_C(0x00000008080100),  6,   92},
+	{UINT64_C(0x000000080a0000), 24,   92}, {UINT64_C(0x00000008100100), 14,  -93}, {UINT64_C(0x00000008110000), 18,   92},
+	{UINT64_C(0x00000008120000),  2,   92}, {UINT64_C(0x00000008420000),  2,   92}, {UINT64_C(0x00000008820000),  2,   92},
+	{UINT64_C(0x0000000c000000), 24,   93}, {UINT64_C(0x0000000c000002), 24,   92}, {UINT64_C(0x0000000c000004), 14,  -93},
+	{UINT64_C(0x0000000c000010), 18,   92}, {UINT64_C(0x0000000c000020),  2,   92}, {UINT64_C(0x0000000c000100), 17,  -93},
+	{UINT64_C(0x0000000c002000),  2,  -91}, {UINT64_C(0x0000000c004000),  2,   92}, {UINT64_C(0x0000000c020000),  8,   92},
+	{UINT64_C(0x00000010000001), 13,   93}, {UINT64_C(0x00000010000005), 13,   92}, {UINT64_C(0x00000010000008), 13,   93},
+	{UINT64_C(0x00000010000009),  6,  -93}, {UINT64_C(0x0000001000000c), 13,   92}, {UINT64_C(0x00000010000010), 13,   93},
+	{UINT64_C(0x00000010000011),  8,  -93}, {UINT64_C(0x00000010000018),  5,  -93}, {UINT64_C(0x00000010000028),  4,   92},
+	{UINT64_C(0x00000010000040), 13,   93}, {UINT64_C(0x00000010000041),  3,  -93}, {UINT64_C(0x00000010000044),  4,   88},
+	{UINT64_C(0x00000010000048),  0,   92}, {UINT64_C(0x00000010000050),  2,  -93}, {UINT64_C(0x00000010000060), 13,   92},
+	{UINT64_C(0x00000010000080),  6,   93}, {UINT64_C(0x00000010000081), 10,   92}, {UINT64_C(0x00000010000088),  0,   92},
+	{UINT64_C(0x00000010000090), 10,   92}, {UINT64_C(0x000000100000c0),  8,  -93}, {UINT64_C(0x00000010000140),  7,  -93},
+	{UINT64_C(0x00000010000208), 13,   92}, {UINT64_C(0x00000010000210), 13,   92}, {UINT64_C(0x00000010000220), 13,   92},
+	{UINT64_C(0x00000010000240), 13,   92}, {UINT64_C(0x00000010000280),  0,   92}, {UINT64_C(0x00000010000300), 13,   92},
+	{UINT64_C(0x00000010000410), 13,   92}, {UINT64_C(0x00000010000440), 13,   92}, {UINT64_C(0x00000010000480),  0,  -89},
+	{UINT64_C(0x00000010001000), 13,   93}, {UINT64_C(0x00000010001001), 24,  -93}, {UINT64_C(0x00000010001004), 13,   92},
+	{UINT64_C(0x00000010001008), 21,  -93}, {UINT64_C(0x00000010001010), 13,   92}, {UINT64_C(0x00000010001020), 13,   92},
+	{UINT64_C(0x00000010001040), 18,  -93}, {UINT64_C(0x00000010001080),  0,   92}, {UINT64_C(0x00000010001100), 13,   92},
+	{UINT64_C(0x00000010002000),  0,   93}, {UINT64_C(0x00000010002001), 26,  -93}, {UINT64_C(0x00000010002008), 23,  -93},
+	{UINT64_C(0x00000010002010), 22,  -93}, {UINT64_C(0x00000010002040), 20,  -93}, {UINT64_C(0x00000010002080), 19,  -91},
+	{UINT64_C(0x00000010003000), 14,  -93}, {UINT64_C(0x00000010005000), 13,   92}, {UINT64_C(0x00000010008000), 13,   93},
+	{UINT64_C(0x00000010008001), 13,   92}, {UINT64_C(0x00000010008004), 13,   92}, {UINT64_C(0x00000010008008), 13,   92},
+	{UINT64_C(0x00000010008010), 13,   92}, {UINT64_C(0x00000010008020), 13,   92}, {UINT64_C(0x00000010008040), 24,  -93},
+	{UINT64_C(0x00000010008080),  0,   92}, {UINT64_C(0x00000010008100), 13,   92}, {UINT64_C(0x00000010008200), 12,  -93},
+	{UINT64_C(0x00000010008400), 13,   92}, {UINT64_C(0x00000010008800), 13,   92}, {UINT64_C(0x00000010009000),  9,  -93},
+	{UINT64_C(0x0000001000a000), 11,  -93}, {UINT64_C(0x0000001000c000), 13,   92}, {UINT64_C(0x00000010010000),  6,   93},
+	{UINT64_C(0x00000010010001), 10,   90}, {UINT64_C(0x00000010010008),  0,   92}, {UINT64_C(0x00000010010010), 10,   92},
+	{UINT64_C(0x00000010010040), 26,  -93}, {UINT64_C(0x00000010010080), 25,  -93}, {UINT64_C(0x00000010010200),  0,   92},
+	{UINT64_C(0x00000010010400), 13,   92}, {UINT64_C(0x00000010011000),  0,   92}, {UINT64_C(0x00000010012000), 10,  -89},
+	{UINT64_C(0x00000010018000), 17,  -93}, {UINT64_C(0x00000010028000), 16,  -93}, {UINT64_C(0x00000010040040), 12,  -93},
+	{UINT64_C(0x00000010040080),  0,   92}, {UINT64_C(0x00000010040100), 13,   92}, {UINT64_C(0x00000010048000), 13,   92},
+	{UINT64_C(0x00000010050000), 13,   92}, {UINT64_C(0x00000010060000), 13,   92}, {UINT64_C(0x00000010080080), 13,  -93},
+	{UINT64_C(0x00000010088000),  0,   92}, {UINT64_C(0x00000010090000),  0,   92}, {UINT64_C(0x00000010208000), 13,   92},
+	{UINT64_C(0x00000010210000),  0,   92}, {UINT64_C(0x00000010220000), 13,   92}, {UINT64_C(0x00000010410000),  0,   92},
+	{UINT64_C(0x00000011000000), 18,   93}, {UINT64_C(0x00000011000001), 12,  -93}, {UINT64_C(0x00000011000004), 13,   88},
+	{UINT64_C(0x00000011000008),  4,   92}, {UINT64_C(0x00000011000010), 10,   92}, {UINT64_C(0x00000011000020),  4,   92},
+	{UINT64_C(0x00000011000040), 15,  -93}, {UINT64_C(0x00000011000080), 19,   92}, {UINT64_C(0x00000011000100), 16,  -93},
+	{UINT64_C(0x00000011001000),  0,   92}, {UINT64_C(0x00000011002000),  2,  -93}, {UINT64_C(0x00000011004000), 10,   92},
+	{UINT64_C(0x00000011008000),  6,  -93}, {UINT64_C(0x00000011010000),  8,  -93}, {UINT64_C(0x00000011020000),  4,   92},
+	{UINT64_C(0x00000012000000), 24,   93}, {UINT64_C(0x00000012000001),  7,  -91}, {UINT64_C(0x00000012000008),  0,   92},
+	{UINT64_C(0x00000012000010), 19,   90}, {UINT64_C(0x00000012000040), 19,   92}, {UINT64_C(0x00000012000080), 16,  -93},
+	{UINT64_C(0x00000012001000),  0,   92}, {UINT64_C(0x00000012002000),  0,  -89}, {UINT64_C(0x00000012008000),  0,   92},
+	{UINT64_C(0x00000012010000),  7,   92}, {UINT64_C(0x00000013000000), 26,  -93}, {UINT64_C(0x00000015000000), 25,  -93},
+	{UINT64_C(0x0000001800000c), 13,   93}, {UINT64_C(0x00000018000014),  6,   95}, {UINT64_C(0x00000018000018),  5,   95},
+	{UINT64_C(0x00000018000024),  8,   95}, {UINT64_C(0x00000018000028),  4,   95}, {UINT64_C(0x00000018000030),  3,   95},
+	{UINT64_C(0x00000018000044),  4,   95}, {UINT64_C(0x00000018000048),  2,  -92}, {UINT64_C(0x00000018000050),  2,   95},
+	{UINT64_C(0x00000018000060),  2,   93}, {UINT64_C(0x00000018000084), 13,   93}, {UINT64_C(0x00000018000088),  2,  -92},
+	{UINT64_C(0x00000018000090),  2,   89}, {UINT64_C(0x000000180000a0),  2,   91}, {UINT64_C(0x000000180000c0),  8,   95},
+	{UINT64_C(0x00000018000104),  5,   95}, {UINT64_C(0x00000018000108),  2,   91}, {UINT64_C(0x00000018000110),  2,   93},
+	{UINT64_C(0x00000018000120),  2,   95}, {UINT64_C(0x00000018000140),  7,   95}, {UINT64_C(0x00000018000180),  6,   95},
+	{UINT64_C(0x00000018000208),  2,  -92}, {UINT64_C(0x00000018000210),  2,   89}, {UINT64_C(0x00000018000220),  2,   91},
+	{UINT64_C(0x00000018000240),  2,  -92}, {UINT64_C(0x00000018000280),  2,  -92}, {UINT64_C(0x00000018000300),  2,   91},
+	{UINT64_C(0x00000018000410),  2,   93}, {UINT64_C(0x00000018000420),  2,   93}, {UINT64_C(0x00000018000440),  2,   93},
+	{UINT64_C(0x00000018000480),  2,   89}, {UINT64_C(0x00000018000500),  2,   93}, {UINT64_C(0x00000018000820),  2,   93},
+	{UINT64_C(0x00000018000840),  2,   93}, {UINT64_C(0x00000018000880),  2,   91}, {UINT64_C(0x00000018000900),  2,   93},
+	{UINT64_C(0x00000018001004), 13,   93}, {UINT64_C(0x00000018001008), 21,   95}, {UINT64_C(0x00000018001010),  2,   91},
+	{UINT64_C(0x00000018001020),  2,   91}, {UINT64_C(0x00000018001040), 18,   95}, {UINT64_C(0x00000018001080),  2,  -92},
+	{UINT64_C(0x00000018001100),  2,   91}, {UINT64_C(0x00000018002004), 24,   95}, {UINT64_C(0x00000018002008), 23,   95},
+	{UINT64_C(0x00000018002010), 22,   95}, {UINT64_C(0x00000018002020), 21,   95}, {UINT64_C(0x00000018002040), 20,   95},
+	{UINT64_C(0x00000018002080), 19,   95}, {UINT64_C(0x00000018002100), 18,   95}, {UINT64_C(0x00000018003000), 14,   95},
+	{UINT64_C(0x00000018004004), 26,   95}, {UINT64_C(0x00000018004008),  2,   91}, {UINT64_C(0x00000018004010),  2,   93},
+	{UINT64_C(0x00000018004020), 23,   95}, {UINT64_C(0x00000018004040),  2,   93}, {UINT64_C(0x00000018004080),  2,   91},
+	{UINT64_C(0x00000018004100), 20,   95}, {UINT64_C(0x00000018005000), 13,   95}, {UINT64_C(0x00000018006000), 12,   95},
+	{UINT64_C(0x00000018008004), 13,   93}, {UINT64_C(0x00000018008008),  2,  -92}, {UINT64_C(0x00000018008010),  2,   89},
+	{UINT64_C(0x00000018008020),  2,   91}, {UINT64_C(0x00000018008040), 24,   95}, {UINT64_C(0x00000018008080),  2,  -92},
+	{UINT64_C(0x00000018008100),  2,   91}, {UINT64_C(0x00000018008200), 12,   95}, {UINT64_C(0x00000018008400),  2,   91},
+	{UINT64_C(0x00000018008800), 13,   95}, {UINT64_C(0x00000018009000),  9,   95}, {UINT64_C(0x0000001800a000), 11,   95},
+	{UINT64_C(0x0000001800c000),  2,   91}, {UINT64_C(0x00000018010004), 13,   93}, {UINT64_C(0x00000018010008),  2,  -92},
+	{UINT64_C(0x00000018010010),  2,   89}, {UINT64_C(0x00000018010020),  2,   91}, {UINT64_C(0x00000018010040), 26,   95},
+	{UINT64_C(0x00000018010080), 25,   95}, {UINT64_C(0x00000018010100), 24,   95}, {UINT64_C(0x00000018010200),  2,  -92},
+	{UINT64_C(0x00000018010400), 13,   95}, {UINT64_C(0x00000018010800),  2,   91}, {UINT64_C(0x00000018011000),  2,  -92},
+	{UINT64_C(0x00000018012000), 10,   95}, {UINT64_C(0x00000018014000),  2,   91}, {UINT64_C(0x00000018018000), 17,   95},
+	{UINT64_C(0x00000018020004), 13,   93}, {UINT64_C(0x00000018020008),  2,  -92}, {UINT64_C(0x00000018020010),  2,   89},
+	{UINT64_C(0x00000018020020),  2,   91}, {UINT64_C(0x00000018020040),  2,  -92}, {UINT64_C(0x00000018020080),  2,  -92},
+	{UINT64_C(0x00000018020100), 26,   95}, {UINT64_C(0x00000018020200), 13,   95}, {UINT64_C(0x00000018020400),  2,   91},
+	{UINT64_C(0x00000018020800), 14,   95}, {UINT64_C(0x00000018021000),  2,  -92}, {UINT64_C(0x00000018022000),  9,   95},
+	{UINT64_C(0x00000018024000), 11,   95}, {UINT64_C(0x00000018028000), 16,   95}, {UINT64_C(0x00000018030000), 15,   95},
+	{UINT64_C(0x00000018040040), 12,   95}, {UINT64_C(0x00000018040080),  2,  -92}, {UINT64_C(0x00000018040100), 13,   95},
+	{UINT64_C(0x00000018048000),  2,  -92}, {UINT64_C(0x00000018050000),  2,  -92}, {UINT64_C(0x00000018060000),  2,  -92},
+	{UINT64_C(0x00000018080080), 13,   95}, {UINT64_C(0x00000018080100),  2,   91}, {UINT64_C(0x00000018088000),  2,  -92},
+	{UINT64_C(0x00000018090000),  2,  -92}, {UINT64_C(0x000000180a0000),  2,  -92}, {UINT64_C(0x00000018100100), 14,   95},
+	{UINT64_C(0x00000018108000),  2,   91}, {UINT64_C(0x00000018110000),  2,   91}, {UINT64_C(0x00000018120000),  2,   91},
+	{UINT64_C(0x00000018208000),  2,  -92}, {UINT64_C(0x00000018210000),  2,  -92}, {UINT64_C(0x00000018220000),  2,  -92},
+	{UINT64_C(0x00000018410000),  2,  -92}, {UINT64_C(0x00000018420000),  2,  -92}, {UINT64_C(0x00000018820000),  2,  -92},
+	{UINT64_C(0x00000019000004), 13,   95}, {UINT64_C(0x00000019000008),  2,  -92}, {UINT64_C(0x00000019000010),  2,   93},
+	{UINT64_C(0x00000019000020),  2,   93}, {UINT64_C(0x00000019000040), 15,   95}, {UINT64_C(0x00000019000080),  2,  -92},
+	{UINT64_C(0x00000019000100), 16,   95}, {UINT64_C(0x00000019001000),  2,  -92}, {UINT64_C(0x00000019002000),  2,   95},
+	{UINT64_C(0x00000019004000),  2,   93}, {UINT64_C(0x00000019008000),  6,   95}, {UINT64_C(0x00000019010000),  8,   95},
+	{UINT64_C(0x00000019020000),  2,  -92}, {UINT64_C(0x0000001a000004), 26,   93}, {UINT64_C(0x0000001a000008),  2,  -92},
+	{UINT64_C(0x0000001a000010),  2,   89}, {UINT64_C(0x0000001a000020),  2,   91}, {UINT64_C(0x0000001a000040),  2,  -92},
+	{UINT64_C(0x0000001a000080), 16,   95}, {UINT64_C(0x0000001a000100),  2,   91}, {UINT64_C(0x0000001a001000),  2,  -92},
+	{UINT64_C(0x0000001a002000),  2,   89}, {UINT64_C(0x0000001a004000),  2,   91}, {UINT64_C(0x0000001a008000),  2,  -92},
+	{UINT64_C(0x0000001a010000),  7,   95}, {UINT64_C(0x0000001a020000),  2,  -92}, {UINT64_C(0x0000001b000000), 26,   95},
+	{UINT64_C(0x0000001c000004), 14,   95}, {UINT64_C(0x0000001c000008),  2,   91}, {UINT64_C(0x0000001c000010),  2,   93},
+	{UINT64_C(0x0000001c000020),  2,   93}, {UINT64_C(0x0000001c000040), 16,   95}, {UINT64_C(0x0000001c000080),  2,   91},
+	{UINT64_C(0x0000001c000100), 17,   95}, {UINT64_C(0x0000001c001000),  2,   91}, {UINT64_C(0x0000001c002000),  2,   93},
+	{UINT64_C(0x0000001c004000),  2,   95}, {UINT64_C(0x0000001c008000),  2,   91}, {UINT64_C(0x0000001c010000),  6,   95},
+	{UINT64_C(0x0000001c020000),  8,   95}, {UINT64_C(0x0000001d000000), 25,   95}, {UINT64_C(0x0000001e000000), 24,   95},
+	{UINT64_C(0x0000002800000a), 13,   93}, {UINT64_C(0x00000028000012),  7,   95}, {UINT64_C(0x00000028000018),  5,   95},
+	{UINT64_C(0x00000028000028),  4,   95}, {UINT64_C(0x00000028000042), 13,   93}, {UINT64_C(0x00000028000048),  1,  -92},
+	{UINT64_C(0x00000028000050),  1,   91}, {UINT64_C(0x00000028000060),  1,  -92}, {UINT64_C(0x00000028000082),  4,   95},
+	{UINT64_C(0x00000028000088),  1,  -92}, {UINT64_C(0x00000028000090),  1,   95}, {UINT64_C(0x000000280000c0),  8,   95},
+	{UINT64_C(0x00000028000140),  7,   95}, {UINT64_C(0x00000028000208),  1,  -92}, {UINT64_C(0x00000028000210),  1,   91},
+	{UINT64_C(0x00000028000220),  1,  -92}, {UINT64_C(0x00000028000240),  1,  -92}, {UINT64_C(0x00000028000280),  1,  -92},
+	{UINT64_C(0x00000028000300),  1,  -92}, {UINT64_C(0x00000028000410),  1,   93}, {UINT64_C(0x00000028000440),  1,   91},
+	{UINT64_C(0x00000028000480),  1,   93}, {UINT64_C(0x00000028001002), 13,   93}, {UINT64_C(0x00000028001008), 21,   95},
+	{UINT64_C(0x00000028001010),  1,   91}, {UINT64_C(0x00000028001020),  1,  -92}, {UINT64_C(0x00000028001040), 18,   95},
+	{UINT64_C(0x00000028001080),  1,  -92}, {UINT64_C(0x00000028001100),  1,  -92}, {UINT64_C(0x00000028002002), 25,   95},
+	{UINT64_C(0x00000028002008), 23,   95}, {UINT64_C(0x00000028002010), 22,   95}, {UINT64_C(0x00000028002040), 20,   95},
+	{UINT64_C(0x00000028002080), 19,   95}, {UINT64_C(0x00000028003000), 14,   95}, {UINT64_C(0x00000028005000), 13,   95},
+	{UINT64_C(0x00000028008002), 13,   93}, {UINT64_C(0x00000028008008),  1,  -92}, {UINT64_C(0x00000028008010),  1,   91},
+	{UINT64_C(0x00000028008020),  1,  -92}, {UINT64_C(0x00000028008040), 24,   95}, {UINT64_C(0x00000028008080),  1,  -92},
+	{UINT64_C(0x00000028008100),  1,  -92}, {UINT64_C(0x00000028008200), 12,   95}, {UINT64_C(0x00000028008400),  1,   91},
+	{UINT64_C(0x00000028008800), 13,   95}, {UINT64_C(0x00000028009000),  9,   95}, {UINT64_C(0x0000002800a000), 11,   95},
+	{UINT64_C(0x0000002800c000),  1,  -92}, {UINT64_C(0x00000028010002), 13,   93}, {UINT64_C(0x00000028010008),  1,  -92},
+	{UINT64_C(0x00000028010010),  1,   91}, {UINT64_C(0x00000028010040), 26,   95}, {UINT64_C(0x00000028010080), 25,   95},
+	{UINT64_C(0x00000028010200),  1,  -92}, {UINT64_C(0x00000028010400), 13,   95}, {UINT64_C(0x00000028011000),  1,  -92},
+	{UINT64_C(0x00000028012000), 10,   95}, {UINT64_C(0x00000028018000), 17,   95}, {UINT64_C(0x00000028028000), 16,   95},
+	{UINT64_C(0x00000028040040), 12,   95}, {UINT64_C(0x00000028040080),  1,  -92}, {UINT64_C(0x00000028040100), 13,   95},
+	{UINT64_C(0x00000028048000),  1,  -92}, {UINT64_C(0x00000028050000),  1,  -92}, {UINT64_C(0x00000028060000),  1,  -92},
+	{UINT64_C(0x00000028080080), 13,   95}, {UINT64_C(0x00000028088000),  1,  -92}, {UINT64_C(0x00000028090000),  1,  -92},
+	{UINT64_C(0x00000028208000),  1,  -92}, {UINT64_C(0x00000028210000),  1,  -92}, {UINT64_C(0x00000028220000),  1,  -92},
+	{UINT64_C(0x00000028410000),  1,  -92}, {UINT64_C(0x00000029000002), 25,   93}, {UINT64_C(0x00000029000008),  1,  -92},
+	{UINT64_C(0x00000029000010),  1,   91}, {UINT64_C(0x00000029000020),  1,  -92}, {UINT64_C(0x00000029000040), 15,   95},
+	{UINT64_C(0x00000029000080),  1,  -92}, {UINT64_C(0x00000029000100), 16,   95}, {UINT64_C(0x00000029001000),  1,  -92},
+	{UINT64_C(0x00000029002000),  1,   91}, {UINT64_C(0x00000029004000),  1,  -92}, {UINT64_C(0x00000029008000),  6,   95},
+	{UINT64_C(0x00000029010000),  8,   95}, {UINT64_C(0x00000029020000),  1,  -92}, {UINT64_C(0x0000002a000002), 13,   95},
+	{UINT64_C(0x0000002a000008),  1,  -92}, {UINT64_C(0x0000002a000010),  1,   93}, {UINT64_C(0x0000002a000040),  1,  -92},
+	{UINT64_C(0x0000002a000080), 16,   95}, {UINT64_C(0x0000002a001000),  1,  -92}, {UINT64_C(0x0000002a002000),  1,   95},
+	{UINT64_C(0x0000002a008000),  1,  -92}, {UINT64_C(0x0000002a010000),  7,   95}, {UINT64_C(0x0000002b000000), 26,   95},
+	{UINT64_C(0x0000002d000000), 25,   95}, {UINT64_C(0x00000050000005), 13,   93}, {UINT64_C(0x00000050000011),  8,   95},
+	{UINT64_C(0x00000050000014),  6,   95}, {UINT64_C(0x00000050000021), 13,   93}, {UINT64_C(0x00000050000024),  8,   95},
+	{UINT64_C(0x00000050000030), 13,   93}, {UINT64_C(0x00000050000044),  4,   95}, {UINT64_C(0x00000050000060), 13,   93},
+	{UINT64_C(0x000000500000a0), 13,   93}, {UINT64_C(0x00000050000101),  4,   95}, {UINT64_C(0x00000050000104),  5,   95},
+	{UINT64_C(0x00000050000110),  0,   95}, {UINT64_C(0x00000050000120),  2,   95}, {UINT64_C(0x00000050000201), 18,   95},
+	{UINT64_C(0x00000050000204), 13,   93}, {UINT64_C(0x00000050000210), 13,   93}, {UINT64_C(0x00000050000220), 13,   93},
+	{UINT64_C(0x00000050000300), 13,   93}, {UINT64_C(0x00000050000401), 20,   95}, {UINT64_C(0x00000050000404), 18,   95},
+	{UINT64_C(0x00000050000410), 13,   93}, {UINT64_C(0x00000050000420), 13,   93}, {UINT64_C(0x00000050000440), 13,   93},
+	{UINT64_C(0x00000050000480), 13,   93}, {UINT64_C(0x00000050000500), 13,   93}, {UINT64_C(0x00000050000600), 11,   95},
+	{UINT64_C(0x00000050000801), 13,   93}, {UINT64_C(0x00000050000804), 20,   95}, {UINT64_C(0x00000050000810), 13,   93},
+	{UINT64_C(0x00000050000820), 13,   93}, {UINT64_C(0x00000050000840), 13,   93}, {UINT64_C(0x00000050000880), 13,   93},
+	{UINT64_C(0x00000050000900), 13,   93}, {UINT64_C(0x00000050000a00), 10,   95}, {UINT64_C(0x00000050000c00),  9,   95},
+	{UINT64_C(0x00000050001400), 13,   93}, {UINT64_C(0x00000050001800), 13,   93}, {UINT64_C(0x00000050002001), 26,   95},
+	{UINT64_C(0x00000050002004), 24,   95}, {UINT64_C(0x00000050002010), 22,   95}, {UINT64_C(0x00000050002020), 21,   95},
+	{UINT64_C(0x00000050002100), 18,   95}, {UINT64_C(0x00000050002200), 17,   95}, {UINT64_C(0x00000050002400), 16,   95},
+	{UINT64_C(0x00000050002800), 15,   95}, {UINT64_C(0x00000050004001), 13,   93}, {UINT64_C(0x00000050004004), 26,   95},
+	{UINT64_C(0x00000050004010), 13,   93}, {UINT64_C(0x00000050004020), 23,   95}, {UINT64_C(0x00000050004040), 13,   93},
+	{UINT64_C(0x00000050004080), 13,   93}, {UINT64_C(0x00000050004100), 20,   95}, {UINT64_C(0x00000050004200), 13,   93},
+	{UINT64_C(0x00000050004400), 13,   93}, {UINT64_C(0x00000050004800), 17,   95}, {UINT64_C(0x00000050005000), 13,   95},
+	{UINT64_C(0x00000050006000), 12,   95}, {UINT64_C(0x00000050008800), 13,   95}, {UINT64_C(0x0000005000c000), 13,   93},
+	{UINT64_C(0x00000050014000), 13,   93}, {UINT64_C(0x00000050020001), 13,   93}, {UINT64_C(0x00000050020004), 13,   93},
+	{UINT64_C(0x00000050020010), 13,   93}, {UINT64_C(0x00000050020020), 13,   93}, {UINT64_C(0x00000050020100), 26,   95},
+	{UINT64_C(0x00000050020200), 13,   95}, {UINT64_C(0x00000050020400), 13,   93}, {UINT64_C(0x00000050020800), 14,   95},
+	{UINT64_C(0x00000050022000),  9,   95}, {UINT64_C(0x00000050024000), 11,   95}, {UINT64_C(0x00000050040001),  9,   95},
+	{UINT64_C(0x00000050040004), 10,   95}, {UINT64_C(0x00000050040010), 13,   93}, {UINT64_C(0x00000050040020), 13,   93},
+	{UINT64_C(0x00000050040100), 13,   95}, {UINT64_C(0x00000050040200),  0,   95}, {UINT64_C(0x00000050040400),  2,   95},
+	{UINT64_C(0x00000050040800), 13,   93}, {UINT64_C(0x00000050042000),  8,   95}, {UINT64_C(0x00000050044000), 13,   93},
+	{UINT64_C(0x00000050060000), 13,   93}, {UINT64_C(0x00000050080001), 13,   93}, {UINT64_C(0x00000050080004), 13,   93},
+	{UINT64_C(0x00000050080010), 13,   93}, {UINT64_C(0x00000050080020), 13,   93}, {UINT64_C(0x00000050080040), 13,   93},
+	{UINT64_C(0x00000050080080), 13,   95}, {UINT64_C(0x00000050080100), 13,   93}, {UINT64_C(0x00000050080200), 13,   93},
+	{UINT64_C(0x00000050080400), 13,   93}, {UINT64_C(0x00000050080800), 13,   93}, {UINT64_C(0x00000050081000), 13,   93},
+	{UINT64_C(0x00000050082000),  7,   95}, {UINT64_C(0x00000050084000), 13,   93}, {UINT64_C(0x00000050088000), 13,   93},
+	{UINT64_C(0x00000050090000), 13,   93}, {UINT64_C(0x000000500a0000), 13,   93}, {UINT64_C(0x000000500c0000), 20,   95},
+	{UINT64_C(0x00000050100001), 10,   95}, {UINT64_C(0x00000050100004), 11,   95}, {UINT64_C(0x00000050100010), 13,   93},
+	{UINT64_C(0x00000050100020), 13,   93}, {UINT64_C(0x00000050100040), 13,   95}, {UINT64_C(0x00000050100080), 13,   93},
+	{UINT64_C(0x00000050100100), 14,   95}, {UINT64_C(0x00000050100200), 13,   93}, {UINT64_C(0x00000050100400),  0,   95},
+	{UINT64_C(0x00000050100800),  2,   95}, {UINT64_C(0x00000050101000), 13,   93}, {UINT64_C(0x00000050102000),  6,   95},
+	{UINT64_C(0x00000050104000),  8,   95}, {UINT64_C(0x00000050108000), 13,   93}, {UINT64_C(0x00000050110000), 13,   93},
+	{UINT64_C(0x00000050120000), 13,   93}, {UINT64_C(0x00000050140000), 19,   95}, {UINT64_C(0x00000050180000), 18,   95},
+	{UINT64_C(0x00000050280000), 13,   93}, {UINT64_C(0x00000050300000), 13,   93}, {UINT64_C(0x00000050400001), 13,   93},
+	{UINT64_C(0x00000050400004), 13,   93}, {UINT64_C(0x00000050400010), 13,   95}, {UINT64_C(0x00000050400020), 13,   93},
+	{UINT64_C(0x00000050400100), 13,   93}, {UINT64_C(0x00000050400200), 13,   93}, {UINT64_C(0x00000050400400), 13,   93},
+	{UINT64_C(0x00000050400800), 13,   93}, {UINT64_C(0x00000050402000),  4,   95}, {UINT64_C(0x00000050404000), 13,   93},
+	{UINT64_C(0x00000050420000), 13,   93}, {UINT64_C(0x00000050440000), 26,   95}, {UINT64_C(0x00000050480000), 25,   95},
+	{UINT64_C(0x00000050500000), 24,   95}, {UINT64_C(0x00000050800001), 20,   93}, {UINT64_C(0x00000050800004), 20,   93},
+	{UINT64_C(0x00000050800010), 22,   93}, {UINT64_C(0x00000050800020), 14,   95}, {UINT64_C(0x00000050800040), 26,   93},
+	{UINT64_C(0x00000050800080), 16,   91}, {UINT64_C(0x00000050800100), 26,   93}, {UINT64_C(0x00000050800200), 13,   91},
+	{UINT64_C(0x00000050800400), 20,   93}, {UINT64_C(0x00000050800800), 20,   93}, {UINT64_C(0x00000050801000), 14,   93},
+	{UINT64_C(0x00000050802000), 20,   93}, {UINT64_C(0x00000050804000),  5,   95}, {UINT64_C(0x00000050808000), 13,   91},
+	{UINT64_C(0x00000050810000), 26,   93}, {UINT64_C(0x00000050820000), 26,   93}, {UINT64_C(0x00000050840000), 20,   93},
+	{UINT64_C(0x00000050880000), 20,   93}, {UINT64_C(0x00000050900000), 26,   95}, {UINT64_C(0x00000050a00000), 22,   95},
+	{UINT64_C(0x00000050c00000), 21,   95}, {UINT64_C(0x00000051100000), 22,   95}, {UINT64_C(0x00000051800000), 26,   93},
+	{UINT64_C(0x00000052800000), 26,   93}, {UINT64_C(0x00000054000001), 13,   95}, {UINT64_C(0x00000054000004), 14,   95},
+	{UINT64_C(0x00000054000010), 13,   93}, {UINT64_C(0x00000054000020), 13,   93}, {UINT64_C(0x00000054000100), 17,   95},
+	{UINT64_C(0x00000054000200), 13,   93}, {UINT64_C(0x00000054000400), 13,   93}, {UINT64_C(0x00000054000800), 13,   93},
+	{UINT64_C(0x00000054002000),  0,   95}, {UINT64_C(0x00000054004000),  2,   95}, {UINT64_C(0x00000054020000),  8,   95},
+	{UINT64_C(0x00000054040000), 22,   95}, {UINT64_C(0x00000054080000), 13,   93}, {UINT64_C(0x00000054100000), 23,   95},
+	{UINT64_C(0x00000054400000), 18,   95}, {UINT64_C(0x00000054800000), 20,   95}, {UINT64_C(0x00000060000003), 13,   93},
+	{UINT64_C(0x00000060000011),  8,   95}, {UINT64_C(0x00000060000012),  7,   95}, {UINT64_C(0x00000060000021), 13,   93},
+	{UINT64_C(0x00000060000022), 13,   93}, {UINT64_C(0x00000060000030), 13,   93}, {UINT64_C(0x00000060000041), 13,   93},
+	{UINT64_C(0x00000060000042), 13,   93}, {UINT64_C(0x00000060000050), 13,   93}, {UINT64_C(0x00000060000060), 13,   93},
+	{UINT64_C(0x00000060000081), 13,   93}, {UINT64_C(0x00000060000082),  4,   95}, {UINT64_C(0x00000060000090),  1,   95},
+	{UINT64_C(0x000000600000a0), 13,   93}, {UINT64_C(0x000000600000c0),  8,   95}, {UINT64_C(0x00000060000101),  4,   95},
+	{UINT64_C(0x00000060000102), 13,   93}, {UINT64_C(0x00000060000110),  0,   95}, {UINT64_C(0x00000060000120), 13,   93},
+	{UINT64_C(0x00000060000140),  7,   95}, {UINT64_C(0x00000060000180),  6,   95}, {UINT64_C(0x00000060000201), 18,   95},
+	{UINT64_C(0x00000060000202), 13,   93}, {UINT64_C(0x00000060000210), 13,   93}, {UINT64_C(0x00000060000220), 13,   93},
+	{UINT64_C(0x00000060000240), 13,   93}, {UINT64_C(0x00000060000280), 13,   93}, {UINT64_C(0x00000060000300), 13,   93},
+	{UINT64_C(0x00000060000401), 20,   95}, {UINT64_C(0x00000060000402), 19,   95}, {UINT64_C(0x00000060000410), 13,   93},
+	{UINT64_C(0x00000060000420), 13,   93}, {UINT64_C(0x00000060000440), 13,   93}, {UINT64_C(0x00000060000480), 13,   93},
+	{UINT64_C(0x00000060000500), 13,   93}, {UINT64_C(0x00000060000600), 11,   95}, {UINT64_C(0x00000060000801), 13,   93},
+	{UINT64_C(0x00000060000802), 13,   93}, {UINT64_C(0x00000060000810), 13,   93}, {UINT64_C(0x00000060000820), 13,   93},
+	{UINT64_C(0x00000060000840), 13,   93}, {UINT64_C(0x00000060000880), 13,   93}, {UINT64_C(0x00000060000900), 13,   93},
+	{UINT64_C(0x00000060000a00), 10,   95}, {UINT64_C(0x00000060000c00),  9,   95}, {UINT64_C(0x00000060001001), 24,   95},
+	{UINT64_C(0x00000060001002), 13,   93}, {UINT64_C(0x00000060001010), 13,   93}, {UINT64_C(0x00000060001020), 13,   93},
+	{UINT64_C(0x00000060001040), 18,   95}, {UINT64_C(0x00000060001080), 13,   93}, {UINT64_C(0x00000060001100), 13,   93},
+	{UINT64_C(0x00000060001200), 15,   95}, {UINT64_C(0x00000060001400), 13,   93}, {UINT64_C(0x00000060001800), 13,   93},
+	{UINT64_C(0x00000060002001), 26,   95}, {UINT64_C(0x00000060002002), 25,   95}, {UINT64_C(0x00000060002010), 22,   95},
+	{UINT64_C(0x00000060002020), 21,   95}, {UINT64_C(0x00000060002040), 20,   95}, {UINT64_C(0x00000060002080), 19,   95},
+	{UINT64_C(0x00000060002100), 18,   95}, {UINT64_C(0x00000060002200), 17,   95}, {UINT64_C(0x00000060002400), 16,   95},
+	{UINT64_C(0x00000060002800), 15,   95}, {UINT64_C(0x00000060003000), 14,   95}, {UINT64_C(0x00000060004001), 13,   93},
+	{UINT64_C(0x00000060004002), 13,   93}, {UINT64_C(0x00000060004010), 13,   93}, {UINT64_C(0x00000060004020), 23,   95},
+	{UINT64_C(0x00000060004040), 13,   93}, {UINT64_C(0x00000060004080), 13,   93}, {UINT64_C(0x00000060004100), 20,   95},
+	{UINT64_C(0x00000060004200), 13,   93}, {UINT64_C(0x00000060004400), 13,   93}, {UINT64_C(0x00000060004800), 17,   95},
+	{UINT64_C(0x00000060005000), 13,   95}, {UINT64_C(0x00000060006000), 12,   95}, {UINT64_C(0x00000060008001), 13,   93},
+	{UINT64_C(0x00000060008002), 13,   93}, {UINT64_C(0x00000060008010), 13,   93}, {UINT64_C(0x00000060008020), 13,   93},
+	{UINT64_C(0x00000060008040), 24,   95}, {UINT64_C(0x00000060008080), 13,   93}, {UINT64_C(0x00000060008100), 13,   93},
+	{UINT64_C(0x00000060008200), 12,   95}, {UINT64_C(0x00000060008400), 13,   93}, {UINT64_C(0x00000060008800), 13,   95},
+	{UINT64_C(0x00000060009000),  9,   95}, {UINT64_C(0x0000006000a000), 11,   95}, {UINT64_C(0x0000006000c000), 13,   93},
+	{UINT64_C(0x00000060010001), 13,   93}, {UINT64_C(0x00000060010002), 13,   93}, {UINT64_C(0x00000060010010), 13,   93},
+	{UINT64_C(0x00000060010020), 13,   93}, {UINT64_C(0x00000060010040), 26,   95}, {UINT64_C(0x00000060010080), 25,   95},
+	{UINT64_C(0x00000060010100), 24,   95}, {UINT64_C(0x00000060010200), 13,   93}, {UINT64_C(0x00000060010400), 13,   95},
+	{UINT64_C(0x00000060010800), 13,   93}, {UINT64_C(0x00000060011000), 13,   93}, {UINT64_C(0x00000060012000), 10,   95},
+	{UINT64_C(0x00000060014000), 13,   93}, {UINT64_C(0x00000060018000), 17,   95}, {UINT64_C(0x00000060020001), 13,   93},
+	{UINT64_C(0x00000060020002), 13,   93}, {UINT64_C(0x00000060020010), 13,   93}, {UINT64_C(0x00000060020020), 13,   93},
+	{UINT64_C(0x00000060020040), 13,   93}, {UINT64_C(0x00000060020080), 13,   93}, {UINT64_C(0x00000060020100), 26,   95},
+	{UINT64_C(0x00000060020200), 13,   95}, {UINT64_C(0x00000060020400), 13,   93}, {UINT64_C(0x00000060020800), 14,   95},
+	{UINT64_C(0x00000060021000), 13,   93}, {UINT64_C(0x00000060022000),  9,   95}, {UINT64_C(0x00000060024000), 11,   95},
+	{UINT64_C(0x00000060028000), 16,   95}, {UINT64_C(0x00000060030000), 15,   95}, {UINT64_C(0x00000060040001),  9,   95},
+	{UINT64_C(0x00000060040002), 13,   93}, {UINT64_C(0x00000060040010), 13,   93}, {UINT64_C(0x00000060040020), 13,   93},
+	{UINT64_C(0x00000060040040), 12,   95}, {UINT64_C(0x00000060040080), 13,   93}, {UINT64_C(0x00000060040100), 13,   95},
+	{UINT64_C(0x00000060040200),  0,   95}, {UINT64_C(0x00000060040400), 13,   93}, {UINT64_C(0x00000060040800), 13,   93},
+	{UINT64_C(0x00000060041000),  6,   95}, {UINT64_C(0x00000060042000),  8,   95}, {UINT64_C(0x00000060044000), 13,   93},
+	{UINT64_C(0x00000060048000), 13,   93}, {UINT64_C(0x00000060050000), 13,   93}, {UINT64_C(0x00000060060000), 13,   93},
+	{UINT64_C(0x00000060080001), 13,   93}, {UINT64_C(0x00000060080002), 10,   95}, {UINT64_C(0x00000060080010), 13,   93},
+	{UINT64_C(0x00000060080020), 13,   93}, {UINT64_C(0x00000060080040), 13,   93}, {UINT64_C(0x00000060080080), 13,   95},
+	{UINT64_C(0x00000060080100), 13,   93}, {UINT64_C(0x00000060080200), 13,   93}, {UINT64_C(0x00000060080400),  1,   95},
+	{UINT64_C(0x00000060080800), 13,   93}, {UINT64_C(0x00000060081000), 13,   93}, {UINT64_C(0x00000060082000),  7,   95},
+	{UINT64_C(0x00000060084000), 13,   93}, {UINT64_C(0x00000060088000), 13,   93}, {UINT64_C(0x00000060090000), 13,   93},
+	{UINT64_C(0x000000600a0000), 13,   93}, {UINT64_C(0x000000600c0000), 20,   95}, {UINT64_C(0x00000060100001), 10,   95},
+	{UINT64_C(0x00000060100002), 13,   93}, {UINT64_C(0x00000060100010), 13,   93}, {UINT64_C(0x00000060100020), 13,   93},
+	{UINT64_C(0x00000060100040), 13,   95}, {UINT64_C(0x00000060100080), 13,   93}, {UINT64_C(0x00000060100100), 14,   95},
+	{UINT64_C(0x00000060100200), 13,   93}, {UINT64_C(0x00000060100400),  0,   95}, {UINT64_C(0x00000060100800), 13,   93},
+	{UINT64_C(0x00000060101000), 13,   93}, {UINT64_C(0x00000060102000),  6,   95}, {UINT64_C(0x00000060104000),  8,   95},
+	{UINT64_C(0x00000060108000), 13,   93}, {UINT64_C(0x00000060110000), 13,   93}, {UINT64_C(0x00000060120000), 13,   93},
+	{UINT64_C(0x00000060140000), 19,   95}, {UINT64_C(0x00000060180000), 18,   95}, {UINT64_C(0x00000060200001), 13,   93},
+	{UINT64_C(0x00000060200002), 13,   93}, {UINT64_C(0x00000060200010), 13,   93}, {UINT64_C(0x00000060200020), 13,   95},
+	{UINT64_C(0x00000060200040), 13,   93}, {UINT64_C(0x00000060200080), 13,   93}, {UINT64_C(0x00000060200100), 13,   93},
+	{UINT64_C(0x00000060200200), 13,   93}, {UINT64_C(0x00000060200400), 13,   93}, {UINT64_C(0x00000060200800), 13,   93},
+	{UINT64_C(0x00000060201000), 13,   93}, {UINT64_C(0x00000060202000),  5,   95}, {UINT64_C(0x00000060204000), 13,   93},
+	{UINT64_C(0x00000060208000), 13,   93}, {UINT64_C(0x00000060210000), 13,   93}, {UINT64_C(0x00000060220000), 13,   93},
+	{UINT64_C(0x00000060240000), 24,   95}, {UINT64_C(0x00000060280000), 13,   93}, {UINT64_C(0x00000060300000), 13,   93},
+	{UINT64_C(0x00000060400001), 13,   93}, {UINT64_C(0x00000060400002), 13,   93}, {UINT64_C(0x00000060400010), 13,   95},
+	{UINT64_C(0x00000060400020), 13,   93}, {UINT64_C(0x00000060400040), 13,   93}, {UINT64_C(0x00000060400080), 13,   93},
+	{UINT64_C(0x00000060400100), 13,   93}, {UINT64_C(0x00000060400200), 13,   93}, {UINT64_C(0x00000060400400), 13,   93},
+	{UINT64_C(0x00000060400800), 13,   93}, {UINT64_C(0x00000060401000), 13,   93}, {UINT64_C(0x00000060402000),  4,   95},
+	{UINT64_C(0x00000060404000), 13,   93}, {UINT64_C(0x00000060408000), 13,   93}, {UINT64_C(0x00000060410000), 13,   93},
+	{UINT64_C(0x00000060420000), 13,   93}, {UINT64_C(0x00000060440000), 26,   95}, {UINT64_C(0x00000060480000), 25,   95},
+	{UINT64_C(0x00000060500000), 24,   95}, {UINT64_C(0x00000060600000), 23,   95}, {UINT64_C(0x00000060800001), 20,   93},
+	{UINT64_C(0x00000060800002), 13,   91}, {UINT64_C(0x00000060800010), 22,   93}, {UINT64_C(0x00000060800020), 14,   95},
+	{UINT64_C(0x00000060800040), 26,   93}, {UINT64_C(0x00000060800080), 13,   91}, {UINT64_C(0x00000060800100), 26,   93},
+	{UINT64_C(0x00000060800200), 13,   91}, {UINT64_C(0x00000060800400), 20,   93}, {UINT64_C(0x00000060800800), 14,   93},
+	{UINT64_C(0x00000060801000), 14,   93}, {UINT64_C(0x00000060802000), 20,   93}, {UINT64_C(0x00000060804000),  5,   95},
+	{UINT64_C(0x00000060808000), 13,   91}, {UINT64_C(0x00000060810000), 26,   93}, {UINT64_C(0x00000060820000), 26,   93},
+	{UINT64_C(0x00000060840000), 20,   93}, {UINT64_C(0x00000060880000), 20,   93}, {UINT64_C(0x00000060900000), 26,   95},
+	{UINT64_C(0x00000060a00000), 22,   95}, {UINT64_C(0x00000060c00000), 21,   95}, {UINT64_C(0x00000061000001), 12,   95},
+	{UINT64_C(0x00000061000002), 25,   93}, {UINT64_C(0x00000061000010),  0,   93}, {UINT64_C(0x00000061000020), 21,   93},
+	{UINT64_C(0x00000061000040), 15,   95}, {UINT64_C(0x00000061000080),  6,   93}, {UINT64_C(0x00000061000100), 16,   95},
+	{UINT64_C(0x00000061000200), 18,   93}, {UINT64_C(0x00000061000400),  0,   93}, {UINT64_C(0x00000061000800), 15,   93},
+	{UINT64_C(0x00000061001000),  0,   95}, {UINT64_C(0x00000061002000),  0,   93}, {UINT64_C(0x00000061004000),  8,   93},
+	{UINT64_C(0x00000061008000),  6,   95}, {UINT64_C(0x00000061010000),  8,   95}, {UINT64_C(0x00000061020000), 26,   93},
+	{UINT64_C(0x00000061040000), 21,   95}, {UINT64_C(0x00000061080000), 18,   93}, {UINT64_C(0x00000061100000), 22,   95},
+	{UINT64_C(0x00000061200000), 18,   95}, {UINT64_C(0x00000061400000), 20,   95}, {UINT64_C(0x00000061800000), 26,   93},
+	{UINT64_C(0x00000062000001), 13,   93}, {UINT64_C(0x00000062000002), 13,   95}, {UINT64_C(0x00000062000010), 13,   93},
+	{UINT64_C(0x00000062000020), 13,   93}, {UINT64_C(0x00000062000040), 13,   93}, {UINT64_C(0x00000062000080), 16,   95},
+	{UINT64_C(0x00000062000100), 13,   93}, {UINT64_C(0x00000062000200), 13,   93}, {UINT64_C(0x00000062000400), 13,   93},
+	{UINT64_C(0x00000062000800), 13,   93}, {UINT64_C(0x00000062001000), 13,   93}, {UINT64_C(0x00000062002000),  1,   95},
+	{UINT64_C(0x00000062004000), 13,   93}, {UINT64_C(0x00000062008000), 13,   93}, {UINT64_C(0x00000062010000),  7,   95},
+	{UINT64_C(0x00000062020000), 13,   93}, {UINT64_C(0x00000062040000), 13,   93}, {UINT64_C(0x00000062080000), 22,   95},
+	{UINT64_C(0x00000062100000), 13,   93}, {UINT64_C(0x00000062200000), 13,   93}, {UINT64_C(0x00000062400000), 19,   95},
+	{UINT64_C(0x00000062800000), 26,   93}, {UINT64_C(0x00000063000000), 26,   95}, {UINT64_C(0x00000064000001), 13,   95},
+	{UINT64_C(0x00000064000002), 13,   93}, {UINT64_C(0x00000064000010), 13,   93}, {UINT64_C(0x00000064000020), 13,   93},
+	{UINT64_C(0x00000064000040), 16,   95}, {UINT64_C(0x00000064000080), 13,   93}, {UINT64_C(0x00000064000100), 17,   95},
+	{UINT64_C(0x00000064000200), 13,   93}, {UINT64_C(0x00000064000400), 13,   93}, {UINT64_C(0x00000064000800), 13,   93},
+	{UINT64_C(0x00000064001000), 13,   93}, {UINT64_C(0x00000064002000),  0,   95}, {UINT64_C(0x00000064004000), 13,   93},
+	{UINT64_C(0x00000064008000), 13,   93}, {UINT64_C(0x00000064010000),  6,   95}, {UINT64_C(0x00000064020000),  8,   95},
+	{UINT64_C(0x00000064040000), 22,   95}, {UINT64_C(0x00000064080000), 13,   93}, {UINT64_C(0x00000064100000), 23,   95},
+	{UINT64_C(0x00000064200000), 13,   93}, {UINT64_C(0x00000064400000), 18,   95}, {UINT64_C(0x00000064800000), 20,   95},
+	{UINT64_C(0x00000065000000), 25,   95}, {UINT64_C(0x00000066000000), 24,   95}, {UINT64_C(0x00000080000001), 13,   93},
+	{UINT64_C(0x00000080000002), 13,   93}, {UINT64_C(0x00000080000003),  2,   90}, {UINT64_C(0x00000080000005),  1,   92},
+	{UINT64_C(0x0000008000000a), 13,   92}, {UINT64_C(0x0000008000000c), 13,   92}, {UINT64_C(0x00000080000028), 13,   92},
+	{UINT64_C(0x00000080000044), 13,   92}, {UINT64_C(0x00000080000200), 13,   93}, {UINT64_C(0x00000080000201), 18,  -93},
+	{UINT64_C(0x00000080000202), 13,   92}, {UINT64_C(0x00000080000204), 13,   92}, {UINT64_C(0x00000080000220), 13,   92},
+	{UINT64_C(0x00000080000300), 13,   92}, {UINT64_C(0x00000080000400), 13,   93}, {UINT64_C(0x00000080000401), 20,  -93},
+	{UINT64_C(0x00000080000402), 19,  -93}, {UINT64_C(0x00000080000408), 13,   92}, {UINT64_C(0x00000080000440), 13,   92},
+	{UINT64_C(0x00000080000480), 13,   92}, {UINT64_C(0x00000080000600), 11,  -93}, {UINT64_C(0x00000080000a00), 10,  -93},
+	{UINT64_C(0x00000080001400), 13,   92}, {UINT64_C(0x00000080001800), 13,   92}, {UINT64_C(0x00000080002000),  0,   93},
+	{UINT64_C(0x00000080002001), 26,  -93}, {UINT64_C(0x00000080002002), 25,  -93}, {UINT64_C(0x00000080002200), 17,  -93},
+	{UINT64_C(0x00000080002400), 16,  -93}, {UINT64_C(0x00000080005000), 13,   92}, {UINT64_C(0x00000080008800), 13,   92},
+	{UINT64_C(0x00000080040000),  0,   93}, {UINT64_C(0x00000080040001),  9,  -93}, {UINT64_C(0x00000080040002),  0,   92},
+	{UINT64_C(0x00000080040004), 10,  -93}, {UINT64_C(0x00000080040020),  1,   92}, {UINT64_C(0x00000080040100), 13,   88},
+	{UINT64_C(0x00000080040200),  0,   92}, {UINT64_C(0x00000080040400),  2,  -91}, {UINT64_C(0x00000080040800),  0,   92},
+	{UINT64_C(0x00000080042000),  8,  -93}, {UINT64_C(0x00000080044000),  1,   92}, {UINT64_C(0x00000080060000),  1,   92},
+	{UINT64_C(0x00000080080000), 18,   93}, {UINT64_C(0x00000080080001),  1,   92}, {UINT64_C(0x00000080080002), 10,  -93},
+	{UINT64_C(0x00000080080008),  0,   92}, {UINT64_C(0x00000080080040),  3,   92}, {UINT64_C(0x00000080080080), 13,   88},
+	{UINT64_C(0x00000080080200),  0,   92}, {UINT64_C(0x00000080080400),  1,   92}, {UINT64_C(0x00000080081000),  0,   92},
+	{UINT64_C(0x00000080082000),  7,  -93}, {UINT64_C(0x00000080088000),  6,   92}, {UINT64_C(0x00000080090000),  6,   92},
+	{UINT64_C(0x000000800c0000), 20,  -93}, {UINT64_C(0x00000080140000), 19,  -93}, {UINT64_C(0x00000080280000),  0,   92},
+	{UINT64_C(0x00000080300000),  2,   92}, {UINT64_C(0x00000080400000), 18,   93}, {UINT64_C(0x00000080400001),  1,   90},
+	{UINT64_C(0x00000080400002),  0,   92}, {UINT64_C(0x00000080400200),  0,   92}, {UINT64_C(0x00000080400400),  0,   92},
+	{UINT64_C(0x00000080402000),  1,  -89}, {UINT64_C(0x00000080440000), 26,  -93}, {UINT64_C(0x00000080480000), 25,  -93},
+	{UINT64_C(0x00000080a00000), 22,  -93}, {UINT64_C(0x00000081100000), 22,  -93}, {UINT64_C(0x00000088000006),  8,  -90},
+	{UINT64_C(0x0000008800000a),  8,  -92}, {UINT64_C(0x0000008800000c),  8,   91}, {UINT64_C(0x00000088000022),  8,   89},
+	{UINT64_C(0x00000088000024),  8,   95}, {UINT64_C(0x00000088000028),  8,  -92}, {UINT64_C(0x00000088000044),  8,   93},
+	{UINT64_C(0x00000088000060),  8,   93}, {UINT64_C(0x000000880000a0),  8,   93}, {UINT64_C(0x00000088000102), 13,   93},
+	{UINT64_C(0x00000088000104),  5,   95}, {UINT64_C(0x00000088000120),  2,   95}, {UINT64_C(0x00000088000202),  8,  -92},
+	{UINT64_C(0x00000088000204),  8,  -90}, {UINT64_C(0x00000088000220),  8,  -92}, {UINT64_C(0x00000088000300), 13,   93},
+	{UINT64_C(0x00000088000402), 19,   95}, {UINT64_C(0x00000088000404), 18,   95}, {UINT64_C(0x00000088000408),  8,  -92},
+	{UINT64_C(0x00000088000420),  8,  -92}, {UINT64_C(0x00000088000440),  8,   89}, {UINT64_C(0x00000088000480),  8,  -92},
+	{UINT64_C(0x00000088000500), 13,   93}, {UINT64_C(0x00000088000600), 11,   95}, {UINT64_C(0x00000088000802),  8,  -92},
+	{UINT64_C(0x00000088000804), 20,   95}, {UINT64_C(0x00000088000808),  8,  -92}, {UINT64_C(0x00000088000820),  8,  -92},
+	{UINT64_C(0x00000088000840),  8,  -90}, {UINT64_C(0x00000088000880),  8,  -92}, {UINT64_C(0x00000088000900), 13,   93},
+	{UINT64_C(0x00000088000a00), 10,   95}, {UINT64_C(0x00000088000c00),  9,   95}, {UINT64_C(0x00000088001400),  8,  -92},
+	{UINT64_C(0x00000088001800),  8,  -92}, {UINT64_C(0x00000088002002), 25,   95}, {UINT64_C(0x00000088002004), 24,   95},
+	{UINT64_C(0x00000088002020), 21,   95}, {UINT64_C(0x00000088002100), 18,   95}, {UINT64_C(0x00000088002200), 17,   95},
+	{UINT64_C(0x00000088002400), 16,   95}, {UINT64_C(0x00000088002800), 15,   95}, {UINT64_C(0x00000088004002),  8,   89},
+	{UINT64_C(0x00000088004004), 26,   95}, {UINT64_C(0x00000088004008),  8,  -90}, {UINT64_C(0x00000088004020), 23,   95},
+	{UINT64_C(0x00000088004040),  8,   93}, {UINT64_C(0x00000088004080),  8,   93}, {UINT64_C(0x00000088004100), 20,   95},
+	{UINT64_C(0x00000088004200),  8,   89}, {UINT64_C(0x00000088004400),  8,   91}, {UINT64_C(0x00000088004800), 17,   95},
+	{UINT64_C(0x00000088005000), 13,   95}, {UINT64_C(0x00000088006000), 12,   95}, {UINT64_C(0x00000088008800), 13,   95},
+	{UINT64_C(0x0000008800c000),  8,  -90}, {UINT64_C(0x00000088014000),  8,   93}, {UINT64_C(0x00000088020002),  8,   91},
+	{UINT64_C(0x00000088020004),  8,   93}, {UINT64_C(0x00000088020020),  8,   93}, {UINT64_C(0x00000088020100), 26,   95},
+	{UINT64_C(0x00000088020200), 13,   95}, {UINT64_C(0x00000088020400),  8,   91}, {UINT64_C(0x00000088020800), 14,   95},
+	{UINT64_C(0x00000088022000),  9,   95}, {UINT64_C(0x00000088024000), 11,   95}, {UINT64_C(0x00000088040002),  8,  -92},
+	{UINT64_C(0x00000088040004), 10,   95}, {UINT64_C(0x00000088040020),  8,   93}, {UINT64_C(0x00000088040100), 13,   95},
+	{UINT64_C(0x00000088040200),  8,  -92}, {UINT64_C(0x00000088040400),  2,   95}, {UINT64_C(0x00000088040800),  8,  -92},
+	{UINT64_C(0x00000088042000),  8,   95}, {UINT64_C(0x00000088044000),  8,   93}, {UINT64_C(0x00000088060000),  8,   93},
+	{UINT64_C(0x00000088080002), 10,   95}, {UINT64_C(0x00000088080004),  8,  -90}, {UINT64_C(0x00000088080008),  8,  -92},
+	{UINT64_C(0x00000088080020),  8,  -92}, {UINT64_C(0x00000088080040),  8,   89}, {UINT64_C(0x00000088080080), 13,   95},
+	{UINT64_C(0x00000088080100), 13,   93}, {UINT64_C(0x00000088080200),  8,  -92}, {UINT64_C(0x00000088080400),  1,   95},
+	{UINT64_C(0x00000088080800),  8,  -92}, {UINT64_C(0x00000088081000),  8,  -92}, {UINT64_C(0x00000088082000),  7,   95},
+	{UINT64_C(0x00000088084000),  8,  -90}, {UINT64_C(0x00000088088000),  8,  -92}, {UINT64_C(0x00000088090000),  8,  -90},
+	{UINT64_C(0x000000880a0000),  8,   91}, {UINT64_C(0x000000880c0000), 20,   95}, {UINT64_C(0x00000088100002),  8,   91},
+	{UINT64_C(0x00000088100004), 11,   95}, {UINT64_C(0x00000088100008),  8,   91}, {UINT64_C(0x00000088100020),  8,   93},
+	{UINT64_C(0x00000088100040), 13,   95}, {UINT64_C(0x00000088100080),  8,   93}, {UINT64_C(0x00000088100100), 14,   95},
+	{UINT64_C(0x00000088100200),  8,   91}, {UINT64_C(0x00000088100400),  8,   91}, {UINT64_C(0x00000088100800),  2,   95},
+	{UINT64_C(0x00000088101000),  8,   91}, {UINT64_C(0x00000088102000),  6,   95}, {UINT64_C(0x00000088104000),  8,   95},
+	{UINT64_C(0x00000088108000),  8,   91}, {UINT64_C(0x00000088110000),  8,   93}, {UINT64_C(0x00000088120000),  8,   93},
+	{UINT64_C(0x00000088140000), 19,   95}, {UINT64_C(0x00000088180000), 18,   95}, {UINT64_C(0x00000088280000),  8,  -92},
+	{UINT64_C(0x00000088300000),  8,   91}, {UINT64_C(0x00000088400002),  8,  -92}, {UINT64_C(0x00000088400004),  8,  -90},
+	{UINT64_C(0x00000088400020),  8,  -92}, {UINT64_C(0x00000088400100), 26,   93}, {UINT64_C(0x00000088400200),  8,  -92},
+	{UINT64_C(0x00000088400400),  8,  -92}, {UINT64_C(0x00000088400800),  8,  -92}, {UINT64_C(0x00000088402000),  8,   89},
+	{UINT64_C(0x00000088404000),  8,  -90}, {UINT64_C(0x00000088420000),  8,   91}, {UINT64_C(0x00000088440000), 26,   95},
+	{UINT64_C(0x00000088480000), 25,   95}, {UINT64_C(0x00000088500000), 24,   95}, {UINT64_C(0x00000088800002),  8,  -92},
+	{UINT64_C(0x00000088800004),  8,  -90}, {UINT64_C(0x00000088800008), 13,   95}, {UINT64_C(0x00000088800020), 14,   95},
+	{UINT64_C(0x00000088800040),  8,  -90}, {UINT64_C(0x00000088800080),  8,  -92}, {UINT64_C(0x00000088800100), 13,   93},
+	{UINT64_C(0x00000088800200),  8,  -92}, {UINT64_C(0x00000088800400),  8,  -92}, {UINT64_C(0x00000088800800),  8,  -92},
+	{UINT64_C(0x00000088801000),  8,  -92}, {UINT64_C(0x00000088802000),  3,   95}, {UINT64_C(0x00000088804000),  5,   95},
+	{UINT64_C(0x00000088808000),  8,  -92}, {UINT64_C(0x00000088810000),  8,  -90}, {UINT64_C(0x00000088820000),  8,   91},
+	{UINT64_C(0x00000088840000),  8,  -92}, {UINT64_C(0x00000088880000),  8,  -92}, {UINT64_C(0x00000088900000), 26,   95},
+	{UINT64_C(0x00000088a00000), 22,   95}, {UINT64_C(0x00000088c00000), 21,   95}, {UINT64_C(0x00000089100000), 22,   95},
+	{UINT64_C(0x00000089800000),  8,   91}, {UINT64_C(0x0000008a800000),  8,  -92}, {UINT64_C(0x0000008c000002),  8,   91},
+	{UINT64_C(0x0000008c000004), 14,   95}, {UINT64_C(0x0000008c000020),  8,   93}, {UINT64_C(0x0000008c000100), 17,   95},
+	{UINT64_C(0x0000008c000200),  8,   91}, {UINT64_C(0x0000008c000400),  8,   91}, {UINT64_C(0x0000008c000800),  8,   91},
+	{UINT64_C(0x0000008c002000),  8,   93}, {UINT64_C(0x0000008c004000),  2,   95}, {UINT64_C(0x0000008c020000),  8,   95},
+	{UINT64_C(0x0000008c040000), 22,   95}, {UINT64_C(0x0000008c080000),  8,   91}, {UINT64_C(0x0000008c100000), 23,   95},
+	{UINT64_C(0x0000008c400000), 18,   95}, {UINT64_C(0x0000008c800000), 20,   95}, {UINT64_C(0x00000090000005),  7,  -92},
+	{UINT64_C(0x00000090000009),  6,   95}, {UINT64_C(0x0000009000000c),  7,  -92}, {UINT64_C(0x00000090000028),  7,  -92},
+	{UINT64_C(0x00000090000041),  3,   95}, {UINT64_C(0x00000090000044),  7,  -88}, {UINT64_C(0x00000090000048),  0,   95},
+	{UINT64_C(0x00000090000060),  7,   89}, {UINT64_C(0x00000090000081), 13,   93}, {UINT64_C(0x00000090000088), 13,   93},
+	{UINT64_C(0x000000900000c0),  8,   95}, {UINT64_C(0x00000090000140),  7,   95}, {UINT64_C(0x00000090000201), 18,   95},
+	{UINT64_C(0x00000090000204),  7,  -92}, {UINT64_C(0x00000090000208),  7,  -92}, {UINT64_C(0x00000090000220),  7,  -92},
+	{UINT64_C(0x00000090000240),  7,   91}, {UINT64_C(0x00000090000280), 13,   93}, {UINT64_C(0x00000090000300),  7,  -88},
+	{UINT64_C(0x00000090000401), 20,   95}, {UINT64_C(0x00000090000408),  7,  -92}, {UINT64_C(0x00000090000440),  7,   91},
+	{UINT64_C(0x00000090000480), 13,   93}, {UINT64_C(0x00000090000600), 11,   95}, {UINT64_C(0x00000090000a00), 10,   95},
+	{UINT64_C(0x00000090001001), 24,   95}, {UINT64_C(0x00000090001004),  7,  -92}, {UINT64_C(0x00000090001008), 21,   95},
+	{UINT64_C(0x00000090001020),  7,  -92}, {UINT64_C(0x00000090001040), 18,   95}, {UINT64_C(0x00000090001080), 13,   93},
+	{UINT64_C(0x00000090001100),  7,   87}, {UINT64_C(0x00000090001200), 15,   95}, {UINT64_C(0x00000090001400),  7,  -92},
+	{UINT64_C(0x00000090001800),  7,  -92}, {UINT64_C(0x00000090002001), 26,   95}, {UINT64_C(0x00000090002008), 23,   95},
+	{UINT64_C(0x00000090002040), 20,   95}, {UINT64_C(0x00000090002080), 19,   95}, {UINT64_C(0x00000090002200), 17,   95},
+	{UINT64_C(0x00000090002400), 16,   95}, {UINT64_C(0x00000090003000), 14,   95}, {UINT64_C(0x00000090005000), 13,   95},
+	{UINT64_C(0x00000090008001),  7,  -92}, {UINT64_C(0x00000090008004),  7,  -92}, {UINT64_C(0x00000090008008),  7,  -92},
+	{UINT64_C(0x00000090008020),  7,  -92}, {UINT64_C(0x00000090008040), 24,   95}, {UINT64_C(0x00000090008080), 13,   93},
+	{UINT64_C(0x00000090008100),  7,  -88}, {UINT64_C(0x00000090008200), 12,   95}, {UINT64_C(0x00000090008400),  7,  -92},
+	{UINT64_C(0x00000090008800), 13,   95}, {UINT64_C(0x00000090009000),  9,   95}, {UINT64_C(0x0000009000a000), 11,   95},
+	{UINT64_C(0x0000009000c000),  7,  -92}, {UINT64_C(0x00000090010001),  7,   91}, {UINT64_C(0x00000090010008),  7,   91},
+	{UINT64_C(0x00000090010040), 26,   95}, {UINT64_C(0x00000090010080), 25,   95}, {UINT64_C(0x00000090010200),  7,   91},
+	{UINT64_C(0x00000090010400), 13,   95}, {UINT64_C(0x00000090011000),  7,   91}, {UINT64_C(0x00000090012000), 10,   95},
+	{UINT64_C(0x00000090018000), 17,   95}, {UINT64_C(0x00000090028000), 16,   95}, {UINT64_C(0x00000090040001),  9,   95},
+	{UINT64_C(0x00000090040004), 10,   95}, {UINT64_C(0x00000090040008),  7,  -92}, {UINT64_C(0x00000090040020),  7,  -92},
+	{UINT64_C(0x00000090040040), 12,   95}, {UINT64_C(0x00000090040080), 13,   93}, {UINT64_C(0x00000090040100), 13,   95},
+	{UINT64_C(0x00000090040200),  0,   95}, {UINT64_C(0x00000090040400),  2,   95}, {UINT64_C(0x00000090040800),  7,  -92},
+	{UINT64_C(0x00000090041000),  6,   95}, {UINT64_C(0x00000090042000),  8,   95}, {UINT64_C(0x00000090044000),  7,  -92},
+	{UINT64_C(0x00000090048000),  7,  -92}, {UINT64_C(0x00000090050000),  7,   91}, {UINT64_C(0x00000090060000),  7,  -92},
+	{UINT64_C(0x00000090080001),  7,  -92}, {UINT64_C(0x00000090080008),  7,  -92}, {UINT64_C(0x00000090080040),  7,   93},
+	{UINT64_C(0x00000090080080), 13,   95}, {UINT64_C(0x00000090080200),  7,  -92}, {UINT64_C(0x00000090080400),  7,  -92},
+	{UINT64_C(0x00000090081000),  7,  -92}, {UINT64_C(0x00000090082000),  7,   95}, {UINT64_C(0x00000090088000),  7,  -92},
+	{UINT64_C(0x00000090090000),  7,   93}, {UINT64_C(0x000000900c0000), 20,   95}, {UINT64_C(0x00000090140000), 19,   95},
+	{UINT64_C(0x00000090200001),  7,  -92}, {UINT64_C(0x00000090200004),  7,  -92}, {UINT64_C(0x00000090200008), 12,   95},
+	{UINT64_C(0x00000090200020), 13,   95}, {UINT64_C(0x00000090200040),  7,  -88}, {UINT64_C(0x00000090200080), 13,   93},
+	{UINT64_C(0x00000090200100),  7,   87}, {UINT64_C(0x00000090200200),  7,  -92}, {UINT64_C(0x00000090200400),  7,  -92},
+	{UINT64_C(0x00000090200800),  7,  -92}, {UINT64_C(0x00000090201000),  3,   95}, {UINT64_C(0x00000090202000),  5,   95},
+	{UINT64_C(0x00000090204000),  7,  -92}, {UINT64_C(0x00000090208000),  7,  -92}, {UINT64_C(0x00000090210000),  7,   91},
+	{UINT64_C(0x00000090220000),  7,  -92}, {UINT64_C(0x00000090240000), 24,   95}, {UINT64_C(0x00000090280000),  7,  -92},
+	{UINT64_C(0x00000090300000),  7,  -92}, {UINT64_C(0x00000090400001),  7,  -90}, {UINT64_C(0x00000090400008),  7,  -92},
+	{UINT64_C(0x00000090400040),  7,  -88}, {UINT64_C(0x00000090400080), 25,   93}, {UINT64_C(0x00000090400200),  7,  -92},
+	{UINT64_C(0x00000090400400),  7,  -92}, {UINT64_C(0x00000090401000),  7,  -92}, {UINT64_C(0x00000090402000),  7,   89},
+	{UINT64_C(0x00000090408000),  7,  -92}, {UINT64_C(0x00000090410000),  7,   91}, {UINT64_C(0x00000090440000), 26,   95},
+	{UINT64_C(0x00000090480000), 25,   95}, {UINT64_C(0x00000090600000), 23,   95}, {UINT64_C(0x00000090a00000), 22,   95},
+	{UINT64_C(0x00000091000001), 12,   95}, {UINT64_C(0x00000091000004), 13,   95}, {UINT64_C(0x00000091000008),  7,  -92},
+	{UINT64_C(0x00000091000020),  7,  -92}, {UINT64_C(0x00000091000040), 15,   95}, {UINT64_C(0x00000091000080), 13,   93},
+	{UINT64_C(0x00000091000100), 16,   95}, {UINT64_C(0x00000091000200),  7,  -92}, {UINT64_C(0x00000091000400),  7,  -92},
+	{UINT64_C(0x00000091000800),  7,  -92}, {UINT64_C(0x00000091001000),  0,   95}, {UINT64_C(0x00000091002000),  2,   95},
+	{UINT64_C(0x00000091004000),  7,  -92}, {UINT64_C(0x00000091008000),  6,   95}, {UINT64_C(0x00000091010000),  8,   95},
+	{UINT64_C(0x00000091020000),  7,  -92}, {UINT64_C(0x00000091040000), 21,   95}, {UINT64_C(0x00000091080000),  7,  -92},
+	{UINT64_C(0x00000091100000), 22,   95}, {UINT64_C(0x00000091200000), 18,   95}, {UINT64_C(0x00000091400000), 20,   95},
+	{UINT64_C(0x00000091800000),  7,  -92}, {UINT64_C(0x00000092000001),  7,   91}, {UINT64_C(0x00000092000008),  7,   91},
+	{UINT64_C(0x00000092000040),  7,   93}, {UINT64_C(0x00000092000080), 16,   95}, {UINT64_C(0x00000092000200),  7,   91},
+	{UINT64_C(0x00000092000400),  7,   91}, {UINT64_C(0x00000092001000),  7,   91}, {UINT64_C(0x00000092002000),  7,   93},
+	{UINT64_C(0x00000092008000),  7,   91}, {UINT64_C(0x00000092010000),  7,   95}, {UINT64_C(0x00000092040000),  7,   91},
+	{UINT64_C(0x00000092080000), 22,   95}, {UINT64_C(0x00000092200000),  7,   91}, {UINT64_C(0x00000092400000), 19,   95},
+	{UINT64_C(0x00000093000000), 26,   95}, {UINT64_C(0x00000095000000), 25,   95}, {UINT64_C(0x00000140000003),  2,   95},
+	{UINT64_C(0x00000140000005),  1,   95}, {UINT64_C(0x00000140000011),  8,   95}, {UINT64_C(0x00000140000012),  7,   95},
+	{UINT64_C(0x00000140000041),  4,   93}, {UINT64_C(0x00000140000042),  4,   93}, {UINT64_C(0x00000140000044),  4,   95},
+	{UINT64_C(0x00000140000082),  4,   95}, {UINT64_C(0x00000140000201), 18,   95}, {UINT64_C(0x00000140000202),  4,   91},
+	{UINT64_C(0x00000140000204),  4,   91}, {UINT64_C(0x00000140000210), 13,   93}, {UINT64_C(0x00000140000240),  4,   91},
+	{UINT64_C(0x00000140000280),  4,   91}, {UINT64_C(0x00000140000300),  4,   91}, {UINT64_C(0x00000140000401), 20,   95},
+	{UINT64_C(0x00000140000402), 19,   95}, {UINT64_C(0x00000140000410), 13,   93}, {UINT64_C(0x00000140000440),  4,   91},
+	{UINT64_C(0x00000140000480),  4,   91}, {UINT64_C(0x00000140000600), 11,   95}, {UINT64_C(0x00000140000a00), 10,   95},
+	{UINT64_C(0x00000140001001), 24,   95}, {UINT64_C(0x00000140001002),  4,   91}, {UINT64_C(0x00000140001004),  4,   91},
+	{UINT64_C(0x00000140001010), 13,   93}, {UINT64_C(0x00000140001200), 15,   95}, {UINT64_C(0x00000140001400),  4,  -92},
+	{UINT64_C(0x00000140001800),  4,  -92}, {UINT64_C(0x00000140002001), 26,   95}, {UINT64_C(0x00000140002002), 25,   95},
+	{UINT64_C(0x00000140002010), 22,   95}, {UINT64_C(0x00000140002200), 17,   95}, {UINT64_C(0x00000140002400), 16,   95},
+	{UINT64_C(0x00000140003000), 14,   95}, {UINT64_C(0x00000140005000), 13,   95}, {UINT64_C(0x00000140008200), 12,   95},
+	{UINT64_C(0x00000140008400),  4,  -92}, {UINT64_C(0x00000140008800), 13,   95}, {UINT64_C(0x00000140010400), 13,   95},
+	{UINT64_C(0x00000140040001),  9,   95}, {UINT64_C(0x00000140040002),  4,   91}, {UINT64_C(0x00000140040004), 10,   95},
+	{UINT64_C(0x00000140040010), 13,   93}, {UINT64_C(0x00000140040040), 12,   95}, {UINT64_C(0x00000140040080),  4,   91},
+	{UINT64_C(0x00000140040100), 13,   95}, {UINT64_C(0x00000140040200),  0,   95}, {UINT64_C(0x00000140040400),  2,   95},
+	{UINT64_C(0x00000140040800),  4,  -92}, {UINT64_C(0x00000140041000),  6,   95}, {UINT64_C(0x00000140042000),  8,   95},
+	{UINT64_C(0x00000140044000),  4,  -92}, {UINT64_C(0x00000140048000),  4,  -92}, {UINT64_C(0x00000140050000),  4,  -92},
+	{UINT64_C(0x00000140060000),  4,  -92}, {UINT64_C(0x00000140080001),  4,   91}, {UINT64_C(0x00000140080002), 10,   95},
+	{UINT64_C(0x00000140080010), 13,   93}, {UINT64_C(0x00000140080040),  4,   91}, {UINT64_C(0x00000140080080), 13,   95},
+	{UINT64_C(0x00000140080200),  4,  -92}, {UINT64_C(0x00000140080400),  1,   95}, {UINT64_C(0x00000140081000),  4,  -92},
+	{UINT64_C(0x00000140082000),  7,   95}, {UINT64_C(0x00000140088000),  4,  -92}, {UINT64_C(0x00000140090000),  4,  -92},
+	{UINT64_C(0x000001400c0000), 20,   95}, {UINT64_C(0x00000140140000), 19,   95}, {UINT64_C(0x00000140200001),  4,   91},
+	{UINT64_C(0x00000140200002),  4,   91}, {UINT64_C(0x00000140200004),  4,   91}, {UINT64_C(0x00000140200010), 22,   93},
+	{UINT64_C(0x00000140200200),  4,  -92}, {UINT64_C(0x00000140200400),  4,  -92}, {UINT64_C(0x00000140200800),  4,  -92},
+	{UINT64_C(0x00000140201000),  4,  -92}, {UINT64_C(0x00000140202000),  4,   91}, {UINT64_C(0x00000140204000),  4,  -90},
+	{UINT64_C(0x00000140240000), 24,   95}, {UINT64_C(0x00000140280000),  4,  -92}, {UINT64_C(0x00000140300000),  4,  -92},
+	{UINT64_C(0x00000140400001),  4,   93}, {UINT64_C(0x00000140400002),  4,   93}, {UINT64_C(0x00000140400010), 13,   95},
+	{UINT64_C(0x00000140400200),  4,  -92}, {UINT64_C(0x00000140400400),  4,  -92}, {UINT64_C(0x00000140401000),  4,  -92},
+	{UINT64_C(0x00000140402000),  4,   95}, {UINT64_C(0x00000140440000), 26,   95}, {UINT64_C(0x00000140480000), 25,   95},
+	{UINT64_C(0x00000140600000), 23,   95}, {UINT64_C(0x00000140a00000), 22,   95}, {UINT64_C(0x00000141040000), 21,   95},
+	{UINT64_C(0x00000141080000),  4,  -92}, {UINT64_C(0x00000141100000), 22,   95}, {UINT64_C(0x00000142080000), 22,   95},
+	{UINT64_C(0x00000220000003),  4,   93}, {UINT64_C(0x0000022000000a),  4,   93}, {UINT64_C(0x00000220000011),  8,   95},
+	{UINT64_C(0x00000220000012),  7,   95}, {UINT64_C(0x00000220000021),  4,   93}, {UINT64_C(0x00000220000022),  4,   93},
+	{UINT64_C(0x00000220000028),  4,   95}, {UINT64_C(0x00000220000101),  4,   95}, {UINT64_C(0x00000220000201), 18,   95},
+	{UINT64_C(0x00000220000202),  4,   87}, {UINT64_C(0x00000220000210), 13,   93}, {UINT64_C(0x00000220000220),  4,   91},
+	{UINT64_C(0x00000220000300),  4,  -92}, {UINT64_C(0x00000220000401), 20,   95}, {UINT64_C(0x00000220000402), 19,   95},
+	{UINT64_C(0x00000220000408),  4,   89}, {UINT64_C(0x00000220000410), 13,   93}, {UINT64_C(0x00000220000420),  4,   91},
+	{UINT64_C(0x00000220000480),  4,   91}, {UINT64_C(0x00000220000500),  4,  -92}, {UINT64_C(0x00000220000600), 11,   95},
+	{UINT64_C(0x00000220000801),  4,  -92}, {UINT64_C(0x00000220000802),  4,   87}, {UINT64_C(0x00000220000808),  4,   87},
+	{UINT64_C(0x00000220000810), 13,   93}, {UINT64_C(0x00000220000a00), 10,   95}, {UINT64_C(0x00000220000c00),  9,   95},
+	{UINT64_C(0x00000220001400),  4,  -92}, {UINT64_C(0x00000220001800),  4,  -92}, {UINT64_C(0x00000220002001), 26,   95},
+	{UINT64_C(0x00000220002002), 25,   95}, {UINT64_C(0x00000220002010), 22,   95}, {UINT64_C(0x00000220002200), 17,   95},
+	{UINT64_C(0x00000220002400), 16,   95}, {UINT64_C(0x00000220002800), 15,   95}, {UINT64_C(0x00000220004200),  4,  -92},
+	{UINT64_C(0x00000220004400),  4,  -92}, {UINT64_C(0x00000220005000), 13,   95}, {UINT64_C(0x00000220008800), 13,   95},
+	{UINT64_C(0x00000220020200), 13,   95}, {UINT64_C(0x00000220040001),  9,   95}, {UINT64_C(0x00000220040002),  4,   91},
+	{UINT64_C(0x00000220040010), 13,   93}, {UINT64_C(0x00000220040020),  4,   91}, {UINT64_C(0x00000220040100), 13,   95},
+	{UINT64_C(0x00000220040200),  0,   95}, {UINT64_C(0x00000220040400),  4,  -92}, {UINT64_C(0x00000220040800),  4,  -92},
+	{UINT64_C(0x00000220042000),  8,   95}, {UINT64_C(0x00000220044000),  4,  -92}, {UINT64_C(0x00000220060000),  4,  -92},
+	{UINT64_C(0x00000220080001),  4,  -92}, {UINT64_C(0x00000220080002), 10,   95}, {UINT64_C(0x00000220080008),  4,   89},
+	{UINT64_C(0x00000220080010), 13,   93}, {UINT64_C(0x00000220080020),  4,   89}, {UINT64_C(0x00000220080080), 13,   95},
+	{UINT64_C(0x00000220080100),  4,  -92}, {UINT64_C(0x00000220080200),  4,  -92}, {UINT64_C(0x00000220080400),  1,   95},
+	{UINT64_C(0x00000220080800),  4,  -92}, {UINT64_C(0x00000220081000),  4,  -92}, {UINT64_C(0x00000220082000),  7,   95},
+	{UINT64_C(0x00000220084000),  4,  -92}, {UINT64_C(0x00000220088000),  4,  -92}, {UINT64_C(0x00000220090000),  4,  -92},
+	{UINT64_C(0x000002200a0000),  4,  -92}, {UINT64_C(0x000002200c0000), 20,   95}, {UINT64_C(0x00000220100001), 10,   95},
+	{UINT64_C(0x00000220100002),  4,   91}, {UINT64_C(0x00000220100008),  4,   91}, {UINT64_C(0x00000220100010),  0,   93},
+	{UINT64_C(0x00000220100200),  4,  -92}, {UINT64_C(0x00000220100400),  0,   95}, {UINT64_C(0x00000220100800),  4,  -92},
+	{UINT64_C(0x00000220101000),  4,  -92}, {UINT64_C(0x00000220102000),  4,   91}, {UINT64_C(0x00000220108000),  4,  -92},
+	{UINT64_C(0x00000220140000), 19,   95}, {UINT64_C(0x00000220180000), 18,   95}, {UINT64_C(0x00000220280000),  4,  -92},
+	{UINT64_C(0x00000220300000),  4,  -92}, {UINT64_C(0x00000220400001),  4,   93}, {UINT64_C(0x00000220400002),  4,   93},
+	{UINT64_C(0x00000220400010), 13,   95}, {UINT64_C(0x00000220400200),  4,  -92}, {UINT64_C(0x00000220400400),  4,  -92},
+	{UINT64_C(0x00000220400800),  4,  -92}, {UINT64_C(0x00000220402000),  4,   95}, {UINT64_C(0x00000220440000), 26,   95},
+	{UINT64_C(0x00000220480000), 25,   95}, {UINT64_C(0x00000220500000), 24,   95}, {UINT64_C(0x00000220840000),  4,  -92},
+	{UINT64_C(0x00000220880000),  4,  -92}, {UINT64_C(0x00000220a00000), 22,   95}, {UINT64_C(0x00000221100000), 22,   95},
+	{UINT64_C(0x00000224040000), 22,   95}, {UINT64_C(0x00001080000003),  2,   95}, {UINT64_C(0x00001080000005),  1,   95},
+	{UINT64_C(0x00001080000006),  0,   95}, {UINT64_C(0x0000108000000a), 13,   93}, {UINT64_C(0x0000108000000c), 13,   93},
+	{UINT64_C(0x00001080000021), 13,   93}, {UINT64_C(0x00001080000022), 13,   93}, {UINT64_C(0x00001080000024),  8,   95},
+	{UINT64_C(0x00001080000028), 13,   93}, {UINT64_C(0x00001080000044), 13,   93}, {UINT64_C(0x00001080000060), 13,   93},
+	{UINT64_C(0x000010800000a0), 13,   93}, {UINT64_C(0x00001080000101), 13,   93}, {UINT64_C(0x00001080000102), 13,   93},
+	{UINT64_C(0x00001080000104),  5,   95}, {UINT64_C(0x00001080000120),  2,   95}, {UINT64_C(0x00001080000401), 20,   95},
+	{UINT64_C(0x00001080000402), 19,   95}, {UINT64_C(0x00001080000404), 18,   95}, {UINT64_C(0x00001080000408), 13,   93},
+	{UINT64_C(0x00001080000420), 13,   93}, {UINT64_C(0x00001080000440), 13,   93}, {UINT64_C(0x00001080000480), 13,   93},
+	{UINT64_C(0x00001080000500), 13,   93}, {UINT64_C(0x00001080000801), 13,   93}, {UINT64_C(0x00001080000802), 13,   93},
+	{UINT64_C(0x00001080000804), 20,   95}, {UINT64_C(0x00001080000808), 13,   93}, {UINT64_C(0x00001080000820), 13,   93},
+	{UINT64_C(0x00001080000840), 13,   93}, {UINT64_C(0x00001080000880), 13,   93}, {UINT64_C(0x00001080000900), 13,   93},
+	{UINT64_C(0x00001080000c00), 13,   93}, {UINT64_C(0x00001080001400), 13,   93}, {UINT64_C(0x00001080001800), 13,   93},
+	{UINT64_C(0x00001080002001), 26,   95}, {UINT64_C(0x00001080002002), 25,   95}, {UINT64_C(0x00001080002004), 24,   95},
+	{UINT64_C(0x00001080002020), 21,   95}, {UINT64_C(0x00001080002100), 18,   95}, {UINT64_C(0x00001080002400), 16,   95},
+	{UINT64_C(0x00001080002800), 15,   95}, {UINT64_C(0x00001080004001), 13,   93}, {UINT64_C(0x00001080004002), 13,   93},
+	{UINT64_C(0x00001080004004), 26,   95}, {UINT64_C(0x00001080004008), 13,   93}, {UINT64_C(0x00001080004020), 23,   95},
+	{UINT64_C(0x00001080004040), 13,   93}, {UINT64_C(0x00001080004080), 13,   93}, {UINT64_C(0x00001080004100), 20,   95},
+	{UINT64_C(0x00001080004400), 13,   93}, {UINT64_C(0x00001080004800), 17,   95}, {UINT64_C(0x00001080005000), 13,   95},
+	{UINT64_C(0x00001080006000), 12,   95}, {UINT64_C(0x00001080008800), 13,   95}, {UINT64_C(0x0000108000c000), 13,   93},
+	{UINT64_C(0x00001080014000), 13,   93}, {UINT64_C(0x00001080020001), 26,   93}, {UINT64_C(0x00001080020002), 13,   91},
+	{UINT64_C(0x00001080020004),  8,   93}, {UINT64_C(0x00001080020020),  8,   93}, {UINT64_C(0x00001080020100), 26,   95},
+	{UINT64_C(0x00001080020400), 16,   93}, {UINT64_C(0x00001080020800), 14,   95}, {UINT64_C(0x00001080022000),  8,   93},
+	{UINT64_C(0x00001080024000), 11,   95}, {UINT64_C(0x00001080040001), 13,   93}, {UINT64_C(0x00001080040002), 13,   93},
+	{UINT64_C(0x00001080040004), 10,   95}, {UINT64_C(0x00001080040020), 13,   93}, {UINT64_C(0x00001080040100), 13,   95},
+	{UINT64_C(0x00001080040400),  2,   95}, {UINT64_C(0x00001080040800), 13,   93}, {UINT64_C(0x00001080042000),  8,   95},
+	{UINT64_C(0x00001080044000), 13,   93}, {UINT64_C(0x00001080060000), 26,   93}, {UINT64_C(0x00001080080001), 13,   93},
+	{UINT64_C(0x00001080080002), 10,   95}, {UINT64_C(0x00001080080004), 13,   93}, {UINT64_C(0x00001080080008), 13,   93},
+	{UINT64_C(0x00001080080020), 13,   93}, {UINT64_C(0x00001080080040), 13,   93}, {UINT64_C(0x00001080080080), 13,   95},
+	{UINT64_C(0x00001080080100), 13,   93}, {UINT64_C(0x00001080080400),  1,   95}, {UINT64_C(0x00001080080800), 13,   93},
+	{UINT64_C(0x00001080081000), 13,   93}, {UINT64_C(0x00001080082000),  7,   95}, {UINT64_C(0x00001080084000), 13,   93},
+	{UINT64_C(0x00001080088000), 13,   93}, {UINT64_C(0x00001080090000), 13,   93}, {UINT64_C(0x000010800a0000), 13,   91},
+	{UINT64_C(0x000010800c0000), 20,   95}, {UINT64_C(0x00001080100001), 10,   95}, {UINT64_C(0x00001080100002), 13,   93},
+	{UINT64_C(0x00001080100004), 11,   95}, {UINT64_C(0x00001080100008), 13,   93}, {UINT64_C(0x00001080100020), 13,   93},
+	{UINT64_C(0x00001080100040), 13,   95}, {UINT64_C(0x00001080100080), 13,   93}, {UINT64_C(0x00001080100100), 14,   95},
+	{UINT64_C(0x00001080100400),  0,   95}, {UINT64_C(0x00001080100800),  2,   95}, {UINT64_C(0x00001080101000), 13,   93},
+	{UINT64_C(0x00001080102000),  6,   95}, {UINT64_C(0x00001080104000),  8,   95}, {UINT64_C(0x00001080108000), 13,   93},
+	{UINT64_C(0x00001080110000), 13,   93}, {UINT64_C(0x00001080120000), 26,   93}, {UINT64_C(0x00001080140000), 19,   95},
+	{UINT64_C(0x00001080180000), 18,   95}, {UINT64_C(0x00001080280000), 13,   93}, {UINT64_C(0x00001080300000), 13,   93},
+	{UINT64_C(0x00001080400001), 20,   93}, {UINT64_C(0x00001080400002), 19,   93}, {UINT64_C(0x00001080400004), 20,   93},
+	{UINT64_C(0x00001080400020), 23,   93}, {UINT64_C(0x00001080400100), 26,   93}, {UINT64_C(0x00001080400400), 18,   93},
+	{UINT64_C(0x00001080400800), 20,   93}, {UINT64_C(0x00001080402000), 18,   93}, {UINT64_C(0x00001080404000), 20,   93},
+	{UINT64_C(0x00001080420000), 26,   93}, {UINT64_C(0x00001080440000), 26,   95}, {UINT64_C(0x00001080480000), 25,   95},
+	{UINT64_C(0x00001080500000), 24,   95}, {UINT64_C(0x00001080800001), 13,   93}, {UINT64_C(0x00001080800002), 13,   93},
+	{UINT64_C(0x00001080800004), 13,   93}, {UINT64_C(0x00001080800008), 13,   95}, {UINT64_C(0x00001080800020), 14,   95},
+	{UINT64_C(0x00001080800040), 13,   93}, {UINT64_C(0x00001080800080), 13,   93}, {UINT64_C(0x00001080800100), 13,   93},
+	{UINT64_C(0x00001080800400), 13,   93}, {UINT64_C(0x00001080800800), 13,   93}, {UINT64_C(0x00001080801000), 13,   93},
+	{UINT64_C(0x00001080802000),  3,   95}, {UINT64_C(0x00001080804000),  5,   95}, {UINT64_C(0x00001080808000), 13,   93},
+	{UINT64_C(0x00001080810000), 13,   93}, {UINT64_C(0x00001080820000), 26,   93}, {UINT64_C(0x00001080840000), 13,   93},
+	{UINT64_C(0x00001080880000), 13,   93}, {UINT64_C(0x00001080900000), 26,   95}, {UINT64_C(0x00001080a00000), 22,   95},
+	{UINT64_C(0x00001080c00000), 21,   95}, {UINT64_C(0x00001081100000), 22,   95}, {UINT64_C(0x00001081800000), 13,   93},
+	{UINT64_C(0x00001082800000), 13,   93}, {UINT64_C(0x00001084000001), 13,   95}, {UINT64_C(0x00001084000002), 13,   93},
+	{UINT64_C(0x00001084000004), 14,   95}, {UINT64_C(0x00001084000020), 13,   93}, {UINT64_C(0x00001084000100), 17,   95},
+	{UINT64_C(0x00001084000400), 13,   93}, {UINT64_C(0x00001084000800), 13,   93}, {UINT64_C(0x00001084002000),  0,   95},
+	{UINT64_C(0x00001084004000),  2,   95}, {UINT64_C(0x00001084020000),  8,   95}, {UINT64_C(0x00001084040000), 22,   95},
+	{UINT64_C(0x00001084080000), 13,   93}, {UINT64_C(0x00001084100000), 23,   95}, {UINT64_C(0x00001084400000), 18,   95},
+	{UINT64_C(0x00001084800000), 20,   95}, {UINT64_C(0x00001100000003),  2,   95}, {UINT64_C(0x00001100000005),  1,   95},
+	{UINT64_C(0x00001100000009),  6,   95}, {UINT64_C(0x0000110000000a), 13,   93}, {UINT64_C(0x0000110000000c), 13,   93},
+	{UINT64_C(0x00001100000011),  8,   95}, {UINT64_C(0x00001100000012),  7,   95}, {UINT64_C(0x00001100000014),  6,   95},
+	{UINT64_C(0x00001100000018), 13,   93}, {UINT64_C(0x00001100000041),  3,   95}, {UINT64_C(0x00001100000042), 13,   93},
+	{UINT64_C(0x00001100000044),  4,   95}, {UINT64_C(0x00001100000048),  0,   95}, {UINT64_C(0x00001100000050),  2,   95},
+	{UINT64_C(0x00001100000081), 13,   93}, {UINT64_C(0x00001100000082),  4,   95}, {UINT64_C(0x00001100000084), 13,   93},
+	{UINT64_C(0x00001100000088), 13,   93}, {UINT64_C(0x00001100000090),  1,   95}, {UINT64_C(0x000011000000c0),  8,   95},
+	{UINT64_C(0x00001100000101),  4,   95}, {UINT64_C(0x00001100000102), 13,   93}, {UINT64_C(0x00001100000104), 13,   93},
+	{UINT64_C(0x00001100000108), 13,   93}, {UINT64_C(0x00001100000110),  0,   95}, {UINT64_C(0x00001100000140),  7,   95},
+	{UINT64_C(0x00001100000180),  6,   95}, {UINT64_C(0x00001100000408), 13,   93}, {UINT64_C(0x00001100000410), 13,   93},
+	{UINT64_C(0x00001100000440), 13,   93}, {UINT64_C(0x00001100000480), 13,   93}, {UINT64_C(0x00001100000500), 13,   93},
+	{UINT64_C(0x00001100000808), 13,   93}, {UINT64_C(0x00001100000840), 13,   93}, {UINT64_C(0x00001100000880), 13,   93},
+	{UINT64_C(0x00001100000900), 13,   93}, {UINT64_C(0x00001100001001), 24,   95}, {UINT64_C(0x00001100001002), 13,   93},
+	{UINT64_C(0x00001100001004), 13,   93}, {UINT64_C(0x00001100001008), 21,   95}, {UINT64_C(0x00001100001010), 13,   93},
+	{UINT64_C(0x00001100001040), 18,   95}, {UINT64_C(0x00001100001080), 13,   93}, {UINT64_C(0x00001100001100), 13,   93},
+	{UINT64_C(0x00001100001400), 13,   93}, {UINT64_C(0x00001100001800), 13,   93}, {UINT64_C(0x00001100002001), 26,   95},
+	{UINT64_C(0x00001100002002), 25,   95}, {UINT64_C(0x00001100002008), 23,   95}, {UINT64_C(0x00001100002010), 22,   95},
+	{UINT64_C(0x00001100002040), 20,   95}, {UINT64_C(0x00001100002080), 19,   95}, {UINT64_C(0x00001100002100), 18,   95},
+	{UINT64_C(0x00001100003000), 14,   95}, {UINT64_C(0x00001100004040), 13,   93}, {UINT64_C(0x00001100004080), 13,   93},
+	{UINT64_C(0x00001100004100), 20,   95}, {UINT64_C(0x00001100005000), 13,   95}, {UINT64_C(0x00001100008001), 13,   93},
+	{UINT64_C(0x00001100008002), 13,   93}, {UINT64_C(0x00001100008004), 13,   93}, {UINT64_C(0x00001100008008), 13,   93},
+	{UINT64_C(0x00001100008010), 13,   93}, {UINT64_C(0x00001100008040), 24,   95}, {UINT64_C(0x00001100008080), 13,   93},
+	{UINT64_C(0x00001100008100), 13,   93}, {UINT64_C(0x00001100008400), 13,   93}, {UINT64_C(0x00001100008800), 13,   95},
+	{UINT64_C(0x00001100009000), 13,   93}, {UINT64_C(0x0000110000a000), 11,   95}, {UINT64_C(0x0000110000c000), 13,   93},
+	{UINT64_C(0x00001100010001), 13,   93}, {UINT64_C(0x00001100010002), 13,   93}, {UINT64_C(0x00001100010004), 13,   93},
+	{UINT64_C(0x00001100010008), 13,   93}, {UINT64_C(0x00001100010010), 13,   93}, {UINT64_C(0x00001100010040), 26,   95},
+	{UINT64_C(0x00001100010080), 25,   95}, {UINT64_C(0x00001100010100), 24,   95}, {UINT64_C(0x00001100010400), 13,   95},
+	{UINT64_C(0x00001100010800), 13,   93}, {UINT64_C(0x00001100011000), 13,   93}, {UINT64_C(0x00001100012000), 10,   95},
+	{UINT64_C(0x00001100014000), 13,   93}, {UINT64_C(0x00001100018000), 17,   95}, {UINT64_C(0x00001100020001),  8,   93},
+	{UINT64_C(0x00001100020002), 13,   91}, {UINT64_C(0x00001100020004), 26,   93}, {UINT64_C(0x00001100020008), 13,   91},
+	{UINT64_C(0x00001100020010),  8,   93}, {UINT64_C(0x00001100020040),  8,   93}, {UINT64_C(0x00001100020080),  8,   93},
+	{UINT64_C(0x00001100020100), 26,   95}, {UINT64_C(0x00001100020400), 16,   93}, {UINT64_C(0x00001100020800), 14,   95},
+	{UINT64_C(0x00001100021000), 14,   93}, {UINT64_C(0x00001100022000),  8,   93}, {UINT64_C(0x00001100024000), 11,   95},
+	{UINT64_C(0x00001100028000), 16,   95}, {UINT64_C(0x00001100030000), 15,   95}, {UINT64_C(0x00001100040040), 12,   95},
+	{UINT64_C(0x00001100040080), 13,   93}, {UINT64_C(0x00001100040100), 13,   95}, {UINT64_C(0x00001100048000), 13,   93},
+	{UINT64_C(0x00001100050000), 13,   93}, {UINT64_C(0x00001100060000), 26,   93}, {UINT64_C(0x00001100080040), 13,   93},
+	{UINT64_C(0x00001100080080), 13,   95}, {UINT64_C(0x00001100088000), 13,   93}, {UINT64_C(0x00001100090000), 13,   93},
+	{UINT64_C(0x000011000a0000), 13,   91}, {UINT64_C(0x00001100100040), 13,   95}, {UINT64_C(0x00001100108000), 13,   93},
+	{UINT64_C(0x00001100110000), 13,   93}, {UINT64_C(0x00001100120000), 26,   93}, {UINT64_C(0x00001100208000), 24,   93},
+	{UINT64_C(0x00001100210000), 24,   93}, {UINT64_C(0x00001100220000), 18,   91}, {UINT64_C(0x00001100408000), 13,   93},
+	{UINT64_C(0x00001100410000), 13,   93}, {UINT64_C(0x00001100808000), 13,   93}, {UINT64_C(0x00001101000001), 12,   95},
+	{UINT64_C(0x00001101000002), 13,   93}, {UINT64_C(0x00001101000004), 13,   95}, {UINT64_C(0x00001101000008), 13,   93},
+	{UINT64_C(0x00001101000010), 13,   93}, {UINT64_C(0x00001101000040), 15,   95}, {UINT64_C(0x00001101000080), 13,   93},
+	{UINT64_C(0x00001101000100), 16,   95}, {UINT64_C(0x00001101000400), 13,   93}, {UINT64_C(0x00001101000800), 13,   93},
+	{UINT64_C(0x00001101001000),  0,   95}, {UINT64_C(0x00001101002000),  2,   95}, {UINT64_C(0x00001101004000), 13,   93},
+	{UINT64_C(0x00001101008000),  6,   95}, {UINT64_C(0x00001101010000),  8,   95}, {UINT64_C(0x00001101020000), 26,   93},
+	{UINT64_C(0x00001101040000), 21,   95}, {UINT64_C(0x00001101080000), 13,   93}, {UINT64_C(0x00001101100000), 22,   95},
+	{UINT64_C(0x00001101200000), 18,   95}, {UINT64_C(0x00001101400000), 20,   95}, {UINT64_C(0x00001101800000), 13,   93},
+	{UINT64_C(0x00001102000001), 13,   93}, {UINT64_C(0x00001102000002), 13,   95}, {UINT64_C(0x00001102000008), 13,   93},
+	{UINT64_C(0x00001102000010), 13,   93}, {UINT64_C(0x00001102000040), 13,   93}, {UINT64_C(0x00001102000080), 16,   95},
+	{UINT64_C(0x00001102000100), 13,   93}, {UINT64_C(0x00001102001000), 13,   93}, {UINT64_C(0x00001102002000),  1,   95},
+	{UINT64_C(0x00001102008000), 13,   93}, {UINT64_C(0x00001102010000),  7,   95}, {UINT64_C(0x00001102020000), 26,   93},
+	{UINT64_C(0x00001103000000), 26,   95}, {UINT64_C(0x00001105000000), 25,   95}, {UINT64_C(0x00001800000003),  2,   95},
+	{UINT64_C(0x00001800000005),  1,   95}, {UINT64_C(0x00001800000006),  0,   95}, {UINT64_C(0x0000180000000a), 13,   93},
+	{UINT64_C(0x0000180000000c), 13,   93}, {UINT64_C(0x00001800000011), 13,   93}, {UINT64_C(0x00001800000012),  7,   95},
+	{UINT64_C(0x00001800000014),  6,   95}, {UINT64_C(0x00001800000021), 13,   93}, {UINT64_C(0x00001800000022), 13,   93},
+	{UINT64_C(0x00001800000024), 13,   93}, {UINT64_C(0x00001800000028),  4,   95}, {UINT64_C(0x00001800000030),  3,   95},
+	{UINT64_C(0x00001800000044),  4,   95}, {UINT64_C(0x00001800000060), 13,   93}, {UINT64_C(0x000018000000a0), 13,   93},
+	{UINT64_C(0x00001800000401), 20,   95}, {UINT64_C(0x00001800000402), 19,   95}, {UINT64_C(0x00001800000404), 18,   95},
+	{UINT64_C(0x00001800000408), 13,   93}, {UINT64_C(0x00001800000410), 13,   93}, {UINT64_C(0x00001800000420), 13,   93},
+	{UINT64_C(0x00001800000440), 13,   93}, {UINT64_C(0x00001800000480), 13,   93}, {UINT64_C(0x00001800000801), 13,   93},
+	{UINT64_C(0x00001800000802), 13,   93}, {UINT64_C(0x00001800000804), 20,   95}, {UINT64_C(0x00001800000808), 13,   93},
+	{UINT64_C(0x00001800000810), 13,   93}, {UINT64_C(0x00001800000820), 13,   93}, {UINT64_C(0x00001800000840), 13,   93},
+	{UINT64_C(0x00001800000880), 13,   93}, {UINT64_C(0x00001800000c00), 13,   93}, {UINT64_C(0x00001800001400), 13,   93},
+	{UINT64_C(0x00001800001800), 13,   93}, {UINT64_C(0x00001800002001), 26,   95}, {UINT64_C(0x00001800002002), 25,   95},
+	{UINT64_C(0x00001800002004), 24,   95}, {UINT64_C(0x00001800002010), 22,   95}, {UINT64_C(0x00001800002020), 21,   95},
+	{UINT64_C(0x00001800002400), 16,   95}, {UINT64_C(0x00001800002800), 15,   95}, {UINT64_C(0x00001800004001), 13,   93},
+	{UINT64_C(0x00001800004002), 13,   93}, {UINT64_C(0x00001800004004), 26,   95}, {UINT64_C(0x00001800004008), 13,   93},
+	{UINT64_C(0x00001800004010), 13,   93}, {UINT64_C(0x00001800004020), 23,   95}, {UINT64_C(0x00001800004040), 13,   93},
+	{UINT64_C(0x00001800004080), 13,   93}, {UINT64_C(0x00001800004400), 13,   93}, {UINT64_C(0x00001800004800), 17,   95},
+	{UINT64_C(0x00001800005000), 13,   95}, {UINT64_C(0x00001800006000), 12,   95}, {UINT64_C(0x00001800008800), 13,   95},
+	{UINT64_C(0x0000180000c000), 13,   93}, {UINT64_C(0x00001800014000), 13,   93}, {UINT64_C(0x00001800020001), 13,   91},
+	{UINT64_C(0x00001800020002), 13,   91}, {UINT64_C(0x00001800020004), 14,   93}, {UINT64_C(0x00001800020010), 13,   91},
+	{UINT64_C(0x00001800020020), 14,   93}, {UINT64_C(0x00001800020400), 16,   93}, {UINT64_C(0x00001800020800), 14,   95},
+	{UINT64_C(0x00001800022000), 16,   93}, {UINT64_C(0x00001800024000), 11,   95}, {UINT64_C(0x00001800040001),  2,   93},
+	{UINT64_C(0x00001800040002),  2,   93}, {UINT64_C(0x00001800040004), 10,   95}, {UINT64_C(0x00001800040010),  2,   93},
+	{UINT64_C(0x00001800040020), 21,   93}, {UINT64_C(0x00001800040400),  2,   95}, {UINT64_C(0x00001800040800), 20,   93},
+	{UINT64_C(0x00001800042000),  6,   93}, {UINT64_C(0x00001800044000),  2,   93}, {UINT64_C(0x00001800060000), 20,   91},
+	{UINT64_C(0x00001800080001), 13,   93}, {UINT64_C(0x00001800080002), 10,   95}, {UINT64_C(0x00001800080004), 13,   93},
+	{UINT64_C(0x00001800080008), 13,   93}, {UINT64_C(0x00001800080010), 13,   93}, {UINT64_C(0x00001800080020), 13,   93},
+	{UINT64_C(0x00001800080040), 13,   93}, {UINT64_C(0x00001800080080), 13,   95}, {UINT64_C(0x00001800080400),  1,   95},
+	{UINT64_C(0x00001800080800), 13,   93}, {UINT64_C(0x00001800081000), 13,   93}, {UINT64_C(0x00001800082000),  7,   95},
+	{UINT64_C(0x00001800084000), 13,   93}, {UINT64_C(0x00001800088000), 13,   93}, {UINT64_C(0x00001800090000), 13,   93},
+	{UINT64_C(0x000018000a0000), 22,   91}, {UINT64_C(0x000018000c0000), 20,   95}, {UINT64_C(0x00001800100001), 10,   95},
+	{UINT64_C(0x00001800100002), 13,   93}, {UINT64_C(0x00001800100004), 11,   95}, {UINT64_C(0x00001800100008), 13,   93},
+	{UINT64_C(0x00001800100010), 13,   93}, {UINT64_C(0x00001800100020), 13,   93}, {UINT64_C(0x00001800100040), 13,   95},
+	{UINT64_C(0x00001800100080), 13,   93}, {UINT64_C(0x00001800100400),  0,   95}, {UINT64_C(0x00001800100800),  2,   95},
+	{UINT64_C(0x00001800101000), 13,   93}, {UINT64_C(0x00001800102000),  6,   95}, {UINT64_C(0x00001800104000), 13,   93},
+	{UINT64_C(0x00001800108000), 13,   93}, {UINT64_C(0x00001800110000), 13,   93}, {UINT64_C(0x00001800120000), 11,   93},
+	{UINT64_C(0x00001800140000), 19,   95}, {UINT64_C(0x00001800180000), 18,   95}, {UINT64_C(0x00001800280000), 13,   93},
+	{UINT64_C(0x00001800300000), 13,   93}, {UINT64_C(0x00001800400001), 13,   93}, {UINT64_C(0x00001800400002), 13,   93},
+	{UINT64_C(0x00001800400004), 13,   93}, {UINT64_C(0x00001800400010), 13,   95}, {UINT64_C(0x00001800400020), 13,   93},
+	{UINT64_C(0x00001800400400), 13,   93}, {UINT64_C(0x00001800400800), 13,   93}, {UINT64_C(0x00001800402000),  4,   95},
+	{UINT64_C(0x00001800404000), 13,   93}, {UINT64_C(0x00001800420000), 18,   91}, {UINT64_C(0x00001800440000), 26,   95},
+	{UINT64_C(0x00001800480000), 25,   95}, {UINT64_C(0x00001800500000), 24,   95}, {UINT64_C(0x00001800800001), 13,   93},
+	{UINT64_C(0x00001800800002), 13,   93}, {UINT64_C(0x00001800800004), 13,   93}, {UINT64_C(0x00001800800008), 13,   95},
+	{UINT64_C(0x00001800800010), 13,   93}, {UINT64_C(0x00001800800020), 14,   95}, {UINT64_C(0x00001800800040), 13,   93},
+	{UINT64_C(0x00001800800080), 13,   93}, {UINT64_C(0x00001800800400), 13,   93}, {UINT64_C(0x00001800800800), 13,   93},
+	{UINT64_C(0x00001800801000), 13,   93}, {UINT64_C(0x00001800802000),  3,   95}, {UINT64_C(0x00001800804000),  5,   95},
+	{UINT64_C(0x00001800808000), 13,   93}, {UINT64_C(0x00001800810000), 13,   93}, {UINT64_C(0x00001800820000), 14,   93},
+	{UINT64_C(0x00001800840000), 20,   93}, {UINT64_C(0x00001800880000), 13,   93}, {UINT64_C(0x00001800900000), 26,   95},
+	{UINT64_C(0x00001800a00000), 22,   95}, {UINT64_C(0x00001800c00000), 21,   95}, {UINT64_C(0x00001801100000), 22,   95},
+	{UINT64_C(0x00001801800000), 13,   93}, {UINT64_C(0x00001802800000), 13,   93}, {UINT64_C(0x00001804000001), 13,   95},
+	{UINT64_C(0x00001804000002), 13,   93}, {UINT64_C(0x00001804000004), 14,   95}, {UINT64_C(0x00001804000010), 13,   93},
+	{UINT64_C(0x00001804000020), 13,   93}, {UINT64_C(0x00001804000400), 13,   93}, {UINT64_C(0x00001804000800), 13,   93},
+	{UINT64_C(0x00001804002000),  0,   95}, {UINT64_C(0x00001804004000),  2,   95}, {UINT64_C(0x00001804020000), 16,   93},
+	{UINT64_C(0x00001804040000), 22,   95}, {UINT64_C(0x00001804080000), 13,   93}, {UINT64_C(0x00001804100000), 23,   95},
+	{UINT64_C(0x00001804400000), 18,   95}, {UINT64_C(0x00001804800000), 20,   95}, {UINT64_C(0x00002080000003),  2,   95},
+	{UINT64_C(0x00002080000005),  1,   95}, {UINT64_C(0x00002080000009),  6,   95}, {UINT64_C(0x0000208000000a), 13,   93},
+	{UINT64_C(0x0000208000000c), 13,   93}, {UINT64_C(0x00002080000028), 13,   93}, {UINT64_C(0x00002080000041),  3,   95},
+	{UINT64_C(0x00002080000042), 13,   93}, {UINT64_C(0x00002080000044), 13,   93}, {UINT64_C(0x00002080000048),  0,   95},
+	{UINT64_C(0x00002080000060), 13,   93}, {UINT64_C(0x00002080000081), 13,   93}, {UINT64_C(0x00002080000082), 13,   93},
+	{UINT64_C(0x00002080000088), 13,   93}, {UINT64_C(0x000020800000c0),  8,   95}, {UINT64_C(0x00002080000140),  7,   95},
+	{UINT64_C(0x00002080000208), 13,   93}, {UINT64_C(0x00002080000220), 13,   93}, {UINT64_C(0x00002080000240), 13,   93},
+	{UINT64_C(0x00002080000280), 13,   93}, {UINT64_C(0x00002080000300), 13,   93}, {UINT64_C(0x00002080001001), 24,   95},
+	{UINT64_C(0x00002080001002), 13,   93}, {UINT64_C(0x00002080001004), 13,   93}, {UINT64_C(0x00002080001008), 21,   95},
+	{UINT64_C(0x00002080001020), 13,   93}, {UINT64_C(0x00002080001040), 18,   95}, {UINT64_C(0x00002080001080), 13,   93},
+	{UINT64_C(0x00002080001100), 13,   93}, {UINT64_C(0x00002080002001), 26,   95}, {UINT64_C(0x00002080002002), 25,   95},
+	{UINT64_C(0x00002080002008), 23,   95}, {UINT64_C(0x00002080002040), 20,   95}, {UINT64_C(0x00002080002080), 19,   95},
+	{UINT64_C(0x00002080003000), 14,   95}, {UINT64_C(0x00002080005000), 13,   95}, {UINT64_C(0x00002080008001), 13,   93},
+	{UINT64_C(0x00002080008002), 13,   93}, {UINT64_C(0x00002080008004), 13,   93}, {UINT64_C(0x00002080008008), 13,   93},
+	{UINT64_C(0x00002080008020), 13,   93}, {UINT64_C(0x00002080008040), 24,   95}, {UINT64_C(0x00002080008080), 13,   93},
+	{UINT64_C(0x00002080008100), 13,   93}, {UINT64_C(0x00002080008200), 12,   95}, {UINT64_C(0x00002080008800), 13,   95},
+	{UINT64_C(0x00002080009000),  9,   95}, {UINT64_C(0x0000208000a000), 11,   95}, {UINT64_C(0x0000208000c000), 13,   93},
+	{UINT64_C(0x00002080010001),  6,   93}, {UINT64_C(0x00002080010002), 25,   93}, {UINT64_C(0x00002080010008),  6,   93},
+	{UINT64_C(0x00002080010040), 26,   95}, {UINT64_C(0x00002080010080), 25,   95}, {UINT64_C(0x00002080010200), 15,   93},
+	{UINT64_C(0x00002080011000),  6,   93}, {UINT64_C(0x00002080012000),  6,   93}, {UINT64_C(0x00002080018000), 17,   95},
+	{UINT64_C(0x00002080028000), 16,   95}, {UINT64_C(0x00002080040040), 12,   95}, {UINT64_C(0x00002080040080), 13,   93},
+	{UINT64_C(0x00002080040100), 13,   95}, {UINT64_C(0x00002080048000), 13,   93}, {UINT64_C(0x00002080050000), 24,   93},
+	{UINT64_C(0x00002080060000), 13,   93}, {UINT64_C(0x00002080080080), 13,   95}, {UINT64_C(0x00002080088000), 13,   93},
+	{UINT64_C(0x00002080090000),  7,   93}, {UINT64_C(0x00002080208000), 13,   93}, {UINT64_C(0x00002080210000), 24,   93},
+	{UINT64_C(0x00002080220000), 13,   93}, {UINT64_C(0x00002080410000), 24,   93}, {UINT64_C(0x00002081000001), 12,   95},
+	{UINT64_C(0x00002081000002), 13,   93}, {UINT64_C(0x00002081000004), 13,   95}, {UINT64_C(0x00002081000008), 13,   93},
+	{UINT64_C(0x00002081000020), 13,   93}, {UINT64_C(0x00002081000040), 15,   95}, {UINT64_C(0x00002081000080), 13,   93},
+	{UINT64_C(0x00002081000100), 16,   95}, {UINT64_C(0x00002081001000),  0,   95}, {UINT64_C(0x00002081002000),  2,   95},
+	{UINT64_C(0x00002081004000), 13,   93}, {UINT64_C(0x00002081008000),  6,   95}, {UINT64_C(0x00002081010000),  8,   95},
+	{UINT64_C(0x00002081020000), 13,   93}, {UINT64_C(0x00002082000001), 13,   93}, {UINT64_C(0x00002082000002), 13,   95},
+	{UINT64_C(0x00002082000008), 13,   93}, {UINT64_C(0x00002082000040), 13,   93}, {UINT64_C(0x00002082000080), 16,   95},
+	{UINT64_C(0x00002082001000), 13,   93}, {UINT64_C(0x00002082002000),  1,   95}, {UINT64_C(0x00002082008000), 13,   93},
+	{UINT64_C(0x00002082010000),  7,   95}, {UINT64_C(0x00002083000000), 26,   95}, {UINT64_C(0x00002085000000), 25,   95},
+	{UINT64_C(0x00002200000003),  2,   95}, {UINT64_C(0x00002200000005),  1,   95}, {UINT64_C(0x00002200000006),  0,   95},
+	{UINT64_C(0x00002200000009), 13,   93}, {UINT64_C(0x0000220000000a), 13,   93}, {UINT64_C(0x0000220000000c), 13,   93},
+	{UINT64_C(0x00002200000011),  8,   95}, {UINT64_C(0x00002200000012),  7,   95}, {UINT64_C(0x00002200000014), 13,   93},
+	{UINT64_C(0x00002200000018),  5,   95}, {UINT64_C(0x00002200000021), 13,   93}, {UINT64_C(0x00002200000022), 13,   93},
+	{UINT64_C(0x00002200000024),  8,   95}, {UINT64_C(0x00002200000028),  4,   95}, {UINT64_C(0x00002200000030),  3,   95},
+	{UINT64_C(0x00002200000081), 13,   93}, {UINT64_C(0x00002200000082),  4,   95}, {UINT64_C(0x00002200000084), 13,   93},
+	{UINT64_C(0x00002200000088), 13,   93}, {UINT64_C(0x00002200000090),  1,   95}, {UINT64_C(0x000022000000a0), 13,   93},
+	{UINT64_C(0x00002200000101),  4,   95}, {UINT64_C(0x00002200000102), 13,   93}, {UINT64_C(0x00002200000104),  5,   95},
+	{UINT64_C(0x00002200000108), 13,   93}, {UINT64_C(0x00002200000110),  0,   95}, {UINT64_C(0x00002200000120),  2,   95},
+	{UINT64_C(0x00002200000180), 13,   93}, {UINT64_C(0x00002200000202), 13,   93}, {UINT64_C(0x00002200000204), 13,   93},
+	{UINT64_C(0x00002200000210), 13,   93}, {UINT64_C(0x00002200000220), 13,   93}, {UINT64_C(0x00002200000280), 13,   93},
+	{UINT64_C(0x00002200000300), 13,   93}, {UINT64_C(0x00002200000801), 13,   93}, {UINT64_C(0x00002200000802), 13,   93},
+	{UINT64_C(0x00002200000804), 20,   95}, {UINT64_C(0x00002200000808), 13,   93}, {UINT64_C(0x00002200000810), 13,   93},
+	{UINT64_C(0x00002200000820), 13,   93}, {UINT64_C(0x00002200000880), 13,   93}, {UINT64_C(0x00002200000900), 13,   93},
+	{UINT64_C(0x00002200000a00), 13,   93}, {UINT64_C(0x00002200001004), 13,   93}, {UINT64_C(0x00002200001010), 13,   93},
+	{UINT64_C(0x00002200001020), 13,   93}, {UINT64_C(0x00002200001080), 13,   93}, {UINT64_C(0x00002200001100), 13,   93},
+	{UINT64_C(0x00002200001800), 13,   93}, {UINT64_C(0x00002200002001), 26,   95}, {UINT64_C(0x00002200002002), 25,   95},
+	{UINT64_C(0x00002200002004), 24,   95}, {UINT64_C(0x00002200002008), 23,   95}, {UINT64_C(0x00002200002010), 22,   95},
+	{UINT64_C(0x00002200002020), 21,   95}, {UINT64_C(0x00002200002080), 19,   95}, {UINT64_C(0x00002200002100), 18,   95},
+	{UINT64_C(0x00002200002800), 15,   95}, {UINT64_C(0x00002200004001), 13,   93}, {UINT64_C(0x00002200004002), 13,   93},
+	{UINT64_C(0x00002200004004), 26,   95}, {UINT64_C(0x00002200004008), 13,   93}, {UINT64_C(0x00002200004010), 13,   93},
+	{UINT64_C(0x00002200004020), 23,   95}, {UINT64_C(0x00002200004080), 13,   93}, {UINT64_C(0x00002200004100), 20,   95},
+	{UINT64_C(0x00002200004200), 13,   93}, {UINT64_C(0x00002200004800), 17,   95}, {UINT64_C(0x00002200005000), 13,   95},
+	{UINT64_C(0x00002200006000), 12,   95}, {UINT64_C(0x00002200008004), 13,   93}, {UINT64_C(0x00002200008020), 13,   93},
+	{UINT64_C(0x00002200008080), 13,   93}, {UINT64_C(0x00002200008100), 13,   93}, {UINT64_C(0x00002200008800), 13,   95},
+	{UINT64_C(0x0000220000c000), 13,   93}, {UINT64_C(0x00002200010001),  8,   93}, {UINT64_C(0x00002200010002),  7,   93},
+	{UINT64_C(0x00002200010004),  8,   93}, {UINT64_C(0x00002200010008), 13,   91}, {UINT64_C(0x00002200010010),  8,   93},
+	{UINT64_C(0x00002200010020),  8,   93}, {UINT64_C(0x00002200010080), 25,   95}, {UINT64_C(0x00002200010100), 24,   95},
+	{UINT64_C(0x00002200010800), 15,   93}, {UINT64_C(0x00002200012000),  8,   93}, {UINT64_C(0x00002200014000),  8,   93},
+	{UINT64_C(0x00002200020001), 13,   93}, {UINT64_C(0x00002200020002), 13,   93}, {UINT64_C(0x00002200020004), 13,   93},
+	{UINT64_C(0x00002200020008), 13,   93}, {UINT64_C(0x00002200020010), 13,   93}, {UINT64_C(0x00002200020020), 13,   93},
+	{UINT64_C(0x00002200020080), 13,   93}, {UINT64_C(0x00002200020100), 26,   95}, {UINT64_C(0x00002200020200), 13,   95},
+	{UINT64_C(0x00002200020800), 14,   95}, {UINT64_C(0x00002200021000), 13,   93}, {UINT64_C(0x00002200022000),  9,   95},
+	{UINT64_C(0x00002200024000), 11,   95}, {UINT64_C(0x00002200028000), 16,   95}, {UINT64_C(0x00002200030000), 15,   95},
+	{UINT64_C(0x00002200040004), 13,   93}, {UINT64_C(0x00002200040020), 13,   93}, {UINT64_C(0x00002200040100), 13,   95},
+	{UINT64_C(0x00002200040800), 13,   93}, {UINT64_C(0x00002200044000), 13,   93}, {UINT64_C(0x00002200060000), 13,   93},
+	{UINT64_C(0x00002200080020), 13,   93}, {UINT64_C(0x00002200080100), 13,   93}, {UINT64_C(0x00002200080800), 13,   93},
+	{UINT64_C(0x00002200084000), 13,   93}, {UINT64_C(0x000022000a0000), 13,   93}, {UINT64_C(0x00002200100001),  2,   93},
+	{UINT64_C(0x00002200100002),  2,   93}, {UINT64_C(0x00002200100004), 11,   95}, {UINT64_C(0x00002200100008), 23,   93},
+	{UINT64_C(0x00002200100010),  8,   93}, {UINT64_C(0x00002200100020),  2,   93}, {UINT64_C(0x00002200100080), 19,   93},
+	{UINT64_C(0x00002200100100), 14,   95}, {UINT64_C(0x00002200100800),  2,   95}, {UINT64_C(0x00002200102000),  8,   93},
+	{UINT64_C(0x00002200104000),  8,   95}, {UINT64_C(0x00002200110000), 24,   93}, {UINT64_C(0x00002200120000), 26,   93},
+	{UINT64_C(0x00002200200020), 13,   95}, {UINT64_C(0x00002200200100), 13,   93}, {UINT64_C(0x00002200204000), 13,   93},
+	{UINT64_C(0x00002200220000), 13,   93}, {UINT64_C(0x00002200400100), 13,   93}, {UINT64_C(0x00002200404000), 13,   93},
+	{UINT64_C(0x00002200420000), 13,   93}, {UINT64_C(0x00002200800001), 13,   93}, {UINT64_C(0x00002200800002), 13,   93},
+	{UINT64_C(0x00002200800004), 13,   93}, {UINT64_C(0x00002200800008), 13,   95}, {UINT64_C(0x00002200800010), 13,   93},
+	{UINT64_C(0x00002200800020), 14,   95}, {UINT64_C(0x00002200800080), 13,   93}, {UINT64_C(0x00002200800100), 13,   93},
+	{UINT64_C(0x00002200800800), 13,   93}, {UINT64_C(0x00002200802000),  3,   95}, {UINT64_C(0x00002200804000),  5,   95},
+	{UINT64_C(0x00002200810000), 20,   91}, {UINT64_C(0x00002200820000), 13,   93}, {UINT64_C(0x00002200900000), 26,   95},
+	{UINT64_C(0x00002201000100), 16,   95}, {UINT64_C(0x00002201020000), 13,   93}, {UINT64_C(0x00002202020000), 13,   93},
+	{UINT64_C(0x00002204000001), 13,   95}, {UINT64_C(0x00002204000002), 13,   93}, {UINT64_C(0x00002204000004), 14,   95},
+	{UINT64_C(0x00002204000008), 13,   93}, {UINT64_C(0x00002204000010), 13,   93}, {UINT64_C(0x00002204000020), 13,   93},
+	{UINT64_C(0x00002204000080), 13,   93}, {UINT64_C(0x00002204000100), 17,   95}, {UINT64_C(0x00002204000800), 13,   93},
+	{UINT64_C(0x00002204002000),  0,   95}, {UINT64_C(0x00002204004000),  2,   95}, {UINT64_C(0x00002204010000), 24,   93},
+	{UINT64_C(0x00002204020000),  8,   95}, {UINT64_C(0x00002204100000), 23,   95}, {UINT64_C(0x00002204800000), 20,   95},
+	{UINT64_C(0x00002400000003),  2,   95}, {UINT64_C(0x00002400000005),  1,   95}, {UINT64_C(0x00002400000009),  6,   95},
+	{UINT64_C(0x0000240000000a), 13,   93}, {UINT64_C(0x0000240000000c), 13,   93}, {UINT64_C(0x00002400000011),  8,   95},
+	{UINT64_C(0x00002400000012), 13,   93}, {UINT64_C(0x00002400000018),  5,   95}, {UINT64_C(0x00002400000028),  4,   95},
+	{UINT64_C(0x00002400000041),  3,   95}, {UINT64_C(0x00002400000042), 13,   93}, {UINT64_C(0x00002400000044),  4,   95},
+	{UINT64_C(0x00002400000048),  0,   95}, {UINT64_C(0x00002400000050),  2,   95}, {UINT64_C(0x00002400000060), 13,   93},
+	{UINT64_C(0x00002400000140), 13,   93}, {UINT64_C(0x00002400000201), 18,   95}, {UINT64_C(0x00002400000202), 13,   93},
+	{UINT64_C(0x00002400000204), 13,   93}, {UINT64_C(0x00002400000208), 13,   93}, {UINT64_C(0x00002400000210), 13,   93},
+	{UINT64_C(0x00002400000220), 13,   93}, {UINT64_C(0x00002400000240), 13,   93}, {UINT64_C(0x00002400000300), 13,   93},
+	{UINT64_C(0x00002400000a00), 13,   93}, {UINT64_C(0x00002400001001), 24,   95}, {UINT64_C(0x00002400001002), 13,   93},
+	{UINT64_C(0x00002400001004), 13,   93}, {UINT64_C(0x00002400001008), 21,   95}, {UINT64_C(0x00002400001010), 13,   93},
+	{UINT64_C(0x00002400001020), 13,   93}, {UINT64_C(0x00002400001040), 18,   95}, {UINT64_C(0x00002400001100), 13,   93},
+	{UINT64_C(0x00002400001200), 15,   95}, {UINT64_C(0x00002400001800), 13,   93}, {UINT64_C(0x00002400002001), 26,   95},
+	{UINT64_C(0x00002400002002), 25,   95}, {UINT64_C(0x00002400002008), 23,   95}, {UINT64_C(0x00002400002010), 22,   95},
+	{UINT64_C(0x00002400002040), 20,   95}, {UINT64_C(0x00002400002200), 17,   95}, {UINT64_C(0x00002400003000), 14,   95},
+	{UINT64_C(0x00002400005000), 13,   95}, {UINT64_C(0x00002400008001), 13,   93}, {UINT64_C(0x00002400008002), 13,   93},
+	{UINT64_C(0x00002400008004), 13,   93}, {UINT64_C(0x00002400008008), 13,   93}, {UINT64_C(0x00002400008010), 13,   93},
+	{UINT64_C(0x00002400008020), 13,   93}, {UINT64_C(0x00002400008040), 24,   95}, {UINT64_C(0x00002400008100), 13,   93},
+	{UINT64_C(0x00002400008200), 12,   95}, {UINT64_C(0x00002400008800), 13,   95}, {UINT64_C(0x00002400009000),  9,   95},
+	{UINT64_C(0x0000240000a000), 11,   95}, {UINT64_C(0x0000240000c000), 13,   93}, {UINT64_C(0x00002400010001),  6,   93},
+	{UINT64_C(0x00002400010002), 13,   91}, {UINT64_C(0x00002400010008),  6,   93}, {UINT64_C(0x00002400010010),  6,   93},
+	{UINT64_C(0x00002400010040), 26,   95}, {UINT64_C(0x00002400010200), 15,   93}, {UINT64_C(0x00002400011000),  6,   93},
+	{UINT64_C(0x00002400012000),  6,   93}, {UINT64_C(0x00002400018000), 17,   95}, {UINT64_C(0x00002400028000), 16,   95},
+	{UINT64_C(0x00002400040001),  9,   95}, {UINT64_C(0x00002400040002), 13,   93}, {UINT64_C(0x00002400040004), 13,   93},
+	{UINT64_C(0x00002400040008), 13,   93}, {UINT64_C(0x00002400040010), 13,   93}, {UINT64_C(0x00002400040020), 13,   93},
+	{UINT64_C(0x00002400040040), 12,   95}, {UINT64_C(0x00002400040100), 13,   95}, {UINT64_C(0x00002400040200),  0,   95},
+	{UINT64_C(0x00002400040800), 13,   93}, {UINT64_C(0x00002400041000),  6,   95}, {UINT64_C(0x00002400042000),  8,   95},
+	{UINT64_C(0x00002400044000), 13,   93}, {UINT64_C(0x00002400048000), 13,   93}, {UINT64_C(0x00002400050000), 24,   93},
+	{UINT64_C(0x00002400060000), 13,   93}, {UINT64_C(0x00002400080001), 18,   93}, {UINT64_C(0x00002400080002), 25,   93},
+	{UINT64_C(0x00002400080008), 13,   91}, {UINT64_C(0x00002400080010), 22,   93}, {UINT64_C(0x00002400080040), 18,   93},
+	{UINT64_C(0x00002400080200), 18,   93}, {UINT64_C(0x00002400081000), 18,   93}, {UINT64_C(0x00002400082000), 18,   93},
+	{UINT64_C(0x00002400088000), 13,   91}, {UINT64_C(0x00002400090000), 22,   91}, {UINT64_C(0x000024000c0000), 20,   95},
+	{UINT64_C(0x00002400140000), 19,   95}, {UINT64_C(0x00002400200001), 13,   93}, {UINT64_C(0x00002400200002), 13,   93},
+	{UINT64_C(0x00002400200004), 13,   93}, {UINT64_C(0x00002400200008), 12,   95}, {UINT64_C(0x00002400200010), 13,   93},
+	{UINT64_C(0x00002400200020), 13,   95}, {UINT64_C(0x00002400200040), 13,   93}, {UINT64_C(0x00002400200100), 13,   93},
+	{UINT64_C(0x00002400200200), 13,   93}, {UINT64_C(0x00002400200800), 13,   93}, {UINT64_C(0x00002400201000),  3,   95},
+	{UINT64_C(0x00002400202000),  5,   95}, {UINT64_C(0x00002400204000), 13,   93}, {UINT64_C(0x00002400208000), 13,   93},
+	{UINT64_C(0x00002400210000), 24,   93}, {UINT64_C(0x00002400220000), 13,   93}, {UINT64_C(0x00002400240000), 24,   95},
+	{UINT64_C(0x00002400280000), 18,   93}, {UINT64_C(0x00002400300000), 13,   93}, {UINT64_C(0x00002400400001), 13,   93},
+	{UINT64_C(0x00002400400002), 13,   93}, {UINT64_C(0x00002400400008), 13,   93}, {UINT64_C(0x00002400400010), 13,   95},
+	{UINT64_C(0x00002400400040), 13,   93}, {UINT64_C(0x00002400400200), 13,   93}, {UINT64_C(0x00002400401000), 13,   93},
+	{UINT64_C(0x00002400402000),  4,   95}, {UINT64_C(0x00002400408000), 13,   93}, {UINT64_C(0x00002400410000), 24,   93},
+	{UINT64_C(0x00002400440000), 26,   95}, {UINT64_C(0x00002400480000), 25,   95}, {UINT64_C(0x00002400600000), 23,   95},
+	{UINT64_C(0x00002400a00000), 22,   95}, {UINT64_C(0x00002401000001), 12,   95}, {UINT64_C(0x00002401000002), 13,   93},
+	{UINT64_C(0x00002401000004), 13,   95}, {UINT64_C(0x00002401000008), 13,   93}, {UINT64_C(0x00002401000010), 13,   93},
+	{UINT64_C(0x00002401000020), 13,   93}, {UINT64_C(0x00002401000040), 15,   95}, {UINT64_C(0x00002401000100), 16,   95},
+	{UINT64_C(0x00002401000200), 13,   93}, {UINT64_C(0x00002401000800), 13,   93}, {UINT64_C(0x00002401001000),  0,   95},
+	{UINT64_C(0x00002401002000),  2,   95}, {UINT64_C(0x00002401004000), 13,   93}, {UINT64_C(0x00002401008000),  6,   95},
+	{UINT64_C(0x00002401010000),  8,   95}, {UINT64_C(0x00002401020000), 13,   93}, {UINT64_C(0x00002401040000), 21,   95},
+	{UINT64_C(0x00002401080000), 18,   93}, {UINT64_C(0x00002401100000), 22,   95}, {UINT64_C(0x00002401200000), 18,   95},
+	{UINT64_C(0x00002401400000), 20,   95}, {UINT64_C(0x00002401800000), 13,   93}, {UINT64_C(0x00002402000001), 13,   93},
+	{UINT64_C(0x00002402000002), 13,   95}, {UINT64_C(0x00002402000008), 13,   93}, {UINT64_C(0x00002402000010), 13,   93},
+	{UINT64_C(0x00002402000040), 13,   93}, {UINT64_C(0x00002402000200), 13,   93}, {UINT64_C(0x00002402001000), 13,   93},
+	{UINT64_C(0x00002402002000),  1,   95}, {UINT64_C(0x00002402008000), 13,   93}, {UINT64_C(0x00002402010000), 24,   93},
+	{UINT64_C(0x00002402040000), 13,   93}, {UINT64_C(0x00002402080000), 22,   95}, {UINT64_C(0x00002402200000), 13,   93},
+	{UINT64_C(0x00002402400000), 19,   95}, {UINT64_C(0x00002403000000), 26,   95}, {UINT64_C(0x00002405000000), 25,   95},
+	{UINT64_C(0x00010000000001),  4,  -90}, {UINT64_C(0x00010000000002),  0,  -90}, {UINT64_C(0x00010000000003),  2,   90},
+	{UINT64_C(0x00010000000005),  1,   92}, {UINT64_C(0x0001000000000a),  0,   92}, {UINT64_C(0x0001000000000c),  4,   92},
+	{UINT64_C(0x00010000000010),  0,  -90}, {UINT64_C(0x00010000000011),  8,   90}, {UINT64_C(0x00010000000012),  7,   90},
+	{UINT64_C(0x00010000000028),  4,   92}, {UINT64_C(0x00010000000044),  4,   92}, {UINT64_C(0x00010000000210),  0,   92},
+	{UINT64_C(0x00010000000220),  2,   92}, {UINT64_C(0x00010000000300),  4,   92}, {UINT64_C(0x00010000000410),  0,   92},
+	{UINT64_C(0x00010000000440),  4,   92}, {UINT64_C(0x00010000000480),  0,   92}, {UINT64_C(0x00010000005000),  0,   92},
+	{UINT64_C(0x00010000008800),  6,   92}, {UINT64_C(0x00010000040100), 23,   92}, {UINT64_C(0x00010008000006), 26,  -90},
+	{UINT64_C(0x0001000800000a), 26,  -92}, {UINT64_C(0x0001000800000c), 26,   89}, {UINT64_C(0x00010008000012),  7,   95},
+	{UINT64_C(0x00010008000014),  6,   95}, {UINT64_C(0x00010008000022), 26,  -92}, {UINT64_C(0x00010008000024),  8,   95},
+	{UINT64_C(0x00010008000028),  4,   95}, {UINT64_C(0x00010008000030),  3,   95}, {UINT64_C(0x00010008000044),  4,   95},
+	{UINT64_C(0x00010008000060), 26,  -90}, {UINT64_C(0x000100080000a0), 26,  -92}, {UINT64_C(0x00010008000102), 26,  -90},
+	{UINT64_C(0x00010008000104),  5,   95}, {UINT64_C(0x00010008000110), 26,  -90}, {UINT64_C(0x00010008000120),  2,   95},
+	{UINT64_C(0x00010008000210), 26,  -92}, {UINT64_C(0x00010008000220), 26,  -92}, {UINT64_C(0x00010008000300), 26,   91},
+	{UINT64_C(0x00010008000410), 26,  -92}, {UINT64_C(0x00010008000420), 26,  -92}, {UINT64_C(0x00010008000440), 26,   91},
+	{UINT64_C(0x00010008000480), 26,  -92}, {UINT64_C(0x00010008000500), 26,  -90}, {UINT64_C(0x00010008000820), 26,  -92},
+	{UINT64_C(0x00010008000840), 26,  -90}, {UINT64_C(0x00010008000880), 26,  -92}, {UINT64_C(0x00010008000900), 26,  -90},
+	{UINT64_C(0x00010008004002), 26,   89}, {UINT64_C(0x00010008004004), 26,   95}, {UINT64_C(0x00010008004008), 26,  -92},
+	{UINT64_C(0x00010008004010), 26,  -92}, {UINT64_C(0x00010008004020), 23,   95}, {UINT64_C(0x00010008004040), 26,   93},
+	{UINT64_C(0x00010008004080), 26,  -92}, {UINT64_C(0x00010008004100), 20,   95}, {UINT64_C(0x00010008005000), 26,  -92},
+	{UINT64_C(0x00010008008800), 26,  -92}, {UINT64_C(0x0001000800c000), 26,  -92}, {UINT64_C(0x00010008014000), 26,   93},
+	{UINT64_C(0x00010008020002), 26,  -92}, {UINT64_C(0x00010008020004), 26,   93}, {UINT64_C(0x00010008020010), 26,   89},
+	{UINT64_C(0x00010008020020), 26,  -92}, {UINT64_C(0x00010008020100), 26,   95}, {UINT64_C(0x00010008020200), 26,  -92},
+	{UINT64_C(0x00010008020400), 26,  -92}, {UINT64_C(0x00010008020800), 14,   95}, {UINT64_C(0x00010008024000), 11,   95},
+	{UINT64_C(0x00010008040100), 26,   93}, {UINT64_C(0x00010008060000), 26,   93}, {UINT64_C(0x00010008080100), 26,  -90},
+	{UINT64_C(0x000100080a0000), 26,  -92}, {UINT64_C(0x00010008100100), 14,   95}, {UINT64_C(0x00010008110000), 26,   93},
+	{UINT64_C(0x00010008120000), 26,   93}, {UINT64_C(0x00010008420000), 26,   93}, {UINT64_C(0x00010008820000), 26,   93},
+	{UINT64_C(0x0001000c000002), 24,   91}, {UINT64_C(0x0001000c000004), 14,   95}, {UINT64_C(0x0001000c000010),  6,   93},
+	{UINT64_C(0x0001000c000020),  8,   93}, {UINT64_C(0x0001000c000100), 17,   95}, {UINT64_C(0x0001000c004000),  2,   95},
+	{UINT64_C(0x0001000c020000),  8,   95}, {UINT64_C(0x00010010000005), 25,  -92}, {UINT64_C(0x00010010000009),  6,   95},
+	{UINT64_C(0x0001001000000c), 25,  -92}, {UINT64_C(0x00010010000011),  8,   95}, {UINT64_C(0x00010010000018),  5,   95},
+	{UINT64_C(0x00010010000028),  4,   95}, {UINT64_C(0x00010010000041),  3,   95}, {UINT64_C(0x00010010000044),  4,   95},
+	{UINT64_C(0x00010010000048),  0,   95}, {UINT64_C(0x00010010000050),  2,   95}, {UINT64_C(0x00010010000060), 25,  -92},
+	{UINT64_C(0x00010010000081), 25,   89}, {UINT64_C(0x00010010000088), 25,  -90}, {UINT64_C(0x00010010000090), 25,  -90},
+	{UINT64_C(0x000100100000c0),  8,   95}, {UINT64_C(0x00010010000140),  7,   95}, {UINT64_C(0x00010010000208), 25,  -92},
+	{UINT64_C(0x00010010000210), 25,  -92}, {UINT64_C(0x00010010000220), 25,  -92}, {UINT64_C(0x00010010000240), 25,  -92},
+	{UINT64_C(0x00010010000280), 25,  -86}, {UINT64_C(0x00010010000300), 25,  -92}, {UINT64_C(0x00010010000410), 25,  -92},
+	{UINT64_C(0x00010010000440), 25,  -92}, {UINT64_C(0x00010010000480), 25,   89}, {UINT64_C(0x00010010001001), 24,   95},
+	{UINT64_C(0x00010010001004), 25,  -92}, {UINT64_C(0x00010010001008), 21,   95}, {UINT64_C(0x00010010001010), 25,  -92},
+	{UINT64_C(0x00010010001020), 25,  -92}, {UINT64_C(0x00010010001040), 18,   95}, {UINT64_C(0x00010010001080), 25,  -90},
+	{UINT64_C(0x00010010001100), 25,  -92}, {UINT64_C(0x00010010005000), 25,  -92}, {UINT64_C(0x00010010008001), 25,  -92},
+	{UINT64_C(0x00010010008004), 25,  -92}, {UINT64_C(0x00010010008008), 25,  -92}, {UINT64_C(0x00010010008010), 25,  -92},
+	{UINT64_C(0x00010010008020), 25,  -92}, {UINT64_C(0x00010010008040), 24,   95}, {UINT64_C(0x00010010008080), 25,  -90},
+	{UINT64_C(0x00010010008100), 25,  -92}, {UINT64_C(0x00010010008200), 12,   95}, {UINT64_C(0x00010010008400), 25,  -92},
+	{UINT64_C(0x00010010008800), 25,  -92}, {UINT64_C(0x00010010009000),  9,   95}, {UINT64_C(0x0001001000c000), 25,  -92},
+	{UINT64_C(0x00010010010001), 25,  -92}, {UINT64_C(0x00010010010008), 25,  -92}, {UINT64_C(0x00010010010010), 25,   89},
+	{UINT64_C(0x00010010010040), 26,   95}, {UINT64_C(0x00010010010080), 25,   95}, {UINT64_C(0x00010010010200), 25,  -92},
+	{UINT64_C(0x00010010010400), 25,  -92}, {UINT64_C(0x00010010011000), 25,  -92}, {UINT64_C(0x00010010018000), 17,   95},
+	{UINT64_C(0x00010010028000), 16,   95}, {UINT64_C(0x00010010040040), 12,   95}, {UINT64_C(0x00010010040080), 25,  -90},
+	{UINT64_C(0x00010010040100), 25,  -92}, {UINT64_C(0x00010010048000), 25,  -92}, {UINT64_C(0x00010010050000), 25,  -92},
+	{UINT64_C(0x00010010060000), 25,  -92}, {UINT64_C(0x00010010080080), 25,   93}, {UINT64_C(0x00010010088000), 25,  -90},
+	{UINT64_C(0x00010010090000), 25,   93}, {UINT64_C(0x00010010208000), 25,  -92}, {UINT64_C(0x00010010210000), 25,  -92},
+	{UINT64_C(0x00010010220000), 25,  -92}, {UINT64_C(0x00010010410000), 25,   93}, {UINT64_C(0x00010011000001), 12,   95},
+	{UINT64_C(0x00010011000004), 25,  -88}, {UINT64_C(0x00010011000008), 25,   91}, {UINT64_C(0x00010011000010), 25,   91},
+	{UINT64_C(0x00010011000020), 25,  -88}, {UINT64_C(0x00010011000040), 15,   95}, {UINT64_C(0x00010011000080), 25,   93},
+	{UINT64_C(0x00010011000100), 16,   95}, {UINT64_C(0x00010011001000),  0,   95}, {UINT64_C(0x00010011004000), 25,   89},
+	{UINT64_C(0x00010011008000),  6,   95}, {UINT64_C(0x00010011010000),  8,   95}, {UINT64_C(0x00010011020000), 25,   87},
+	{UINT64_C(0x00010012000001), 24,   93}, {UINT64_C(0x00010012000008), 24,   91}, {UINT64_C(0x00010012000010), 19,   89},
+	{UINT64_C(0x00010012000040), 24,   93}, {UINT64_C(0x00010012000080), 16,   95}, {UINT64_C(0x00010012001000), 24,   93},
+	{UINT64_C(0x00010012008000), 24,   93}, {UINT64_C(0x00010012010000),  7,   95}, {UINT64_C(0x00010013000000), 26,   95},
+	{UINT64_C(0x00010015000000), 25,   95}, {UINT64_C(0x00010080000003),  2,   95}, {UINT64_C(0x00010080000005),  1,   95},
+	{UINT64_C(0x0001008000000a), 22,  -92}, {UINT64_C(0x0001008000000c), 22,  -92}, {UINT64_C(0x00010080000028), 22,  -92},
+	{UINT64_C(0x00010080000044), 22,  -92}, {UINT64_C(0x00010080000201), 18,   95}, {UINT64_C(0x00010080000202), 22,  -92},
+	{UINT64_C(0x00010080000204), 22,  -92}, {UINT64_C(0x00010080000220), 22,  -92}, {UINT64_C(0x00010080000300), 22,  -92},
+	{UINT64_C(0x00010080000401), 20,   95}, {UINT64_C(0x00010080000402), 19,   95}, {UINT64_C(0x00010080000408), 22,  -92},
+	{UINT64_C(0x00010080000440), 22,  -92}, {UINT64_C(0x00010080000480), 22,  -92}, {UINT64_C(0x00010080000600), 11,   95},
+	{UINT64_C(0x00010080000a00), 10,   95}, {UINT64_C(0x00010080001400), 22,  -92}, {UINT64_C(0x00010080001800), 22,  -92},
+	{UINT64_C(0x00010080005000), 22,  -92}, {UINT64_C(0x00010080008800), 22,  -92}, {UINT64_C(0x00010080040001),  9,   95},
+	{UINT64_C(0x00010080040002), 22,   91}, {UINT64_C(0x00010080040004), 10,   95}, {UINT64_C(0x00010080040020), 22,  -88},
+	{UINT64_C(0x00010080040100), 22,  -88}, {UINT64_C(0x00010080040200),  0,   95}, {UINT64_C(0x00010080040400),  2,   95},
+	{UINT64_C(0x00010080040800), 22,  -88}, {UINT64_C(0x00010080044000), 22,  -88}, {UINT64_C(0x00010080060000), 22,   89},
+	{UINT64_C(0x00010080080001), 22,   91}, {UINT64_C(0x00010080080002), 10,   95}, {UINT64_C(0x00010080080008), 22,  -88},
+	{UINT64_C(0x00010080080040), 22,  -88}, {UINT64_C(0x00010080080080), 22,  -88}, {UINT64_C(0x00010080080200), 22,  -88},
+	{UINT64_C(0x00010080080400),  1,   95}, {UINT64_C(0x00010080081000), 22,  -88}, {UINT64_C(0x00010080088000), 22,  -84},
+	{UINT64_C(0x00010080090000), 22,   89}, {UINT64_C(0x000100800c0000), 20,   95}, {UINT64_C(0x00010080140000), 19,   95},
+	{UINT64_C(0x00010080280000), 22,   93}, {UINT64_C(0x00010080300000), 22,   93}, {UINT64_C(0x00010080400001), 18,   93},
+	{UINT64_C(0x00010080400002), 19,   93}, {UINT64_C(0x00010080400200), 18,   93}, {UINT64_C(0x00010080400400), 18,   93},
+	{UINT64_C(0x00010080440000), 26,   95}, {UINT64_C(0x00010080480000), 25,   95}, {UINT64_C(0x00010080a00000), 22,   95},
+	{UINT64_C(0x00010081100000), 22,   95}, {UINT64_C(0x00028000000003),  2,   95}, {UINT64_C(0x00028000000005),  1,   95},
+	{UINT64_C(0x00028000000009),  6,   95}, {UINT64_C(0x0002800000000a), 13,   93}, {UINT64_C(0x0002800000000c), 13,   93},
+	{UINT64_C(0x00028000000011),  8,   95}, {UINT64_C(0x00028000000012),  7,   95}, {UINT64_C(0x00028000000018),  5,   95},
+	{UINT64_C(0x00028000000028),  4,   95}, {UINT64_C(0x00028000000041),  3,   95}, {UINT64_C(0x00028000000042), 13,   93},
+	{UINT64_C(0x00028000000044),  4,   95}, {UINT64_C(0x00028000000082),  4,   95}, {UINT64_C(0x00028000000208), 13,   93},
+	{UINT64_C(0x00028000000210), 13,   93}, {UINT64_C(0x00028000000220), 13,   93}, {UINT64_C(0x00028000000240), 13,   93},
+	{UINT64_C(0x00028000000280), 13,   93}, {UINT64_C(0x00028000000300), 13,   93}, {UINT64_C(0x00028000000410), 13,   93},
+	{UINT64_C(0x00028000000440), 13,   93}, {UINT64_C(0x00028000000480), 13,   93}, {UINT64_C(0x00028000002001), 26,   95},
+	{UINT64_C(0x00028000002002), 25,   95}, {UINT64_C(0x00028000002008), 23,   95}, {UINT64_C(0x00028000002010), 22,   95},
+	{UINT64_C(0x00028000008200), 13,   93}, {UINT64_C(0x00028000008400), 13,   93}, {UINT64_C(0x00028000008800), 13,   95},
+	{UINT64_C(0x00028000010400), 13,   95}, {UINT64_C(0x00028000040040), 13,   93}, {UINT64_C(0x00028000040080), 13,   93},
+	{UINT64_C(0x00028000040100), 13,   95}, {UINT64_C(0x00028000080080), 13,   95}, {UINT64_C(0x00044000000003),  2,   95},
+	{UINT64_C(0x00044000000005),  1,   95}, {UINT64_C(0x00044000000006),  0,   95}, {UINT64_C(0x0004400000000a), 13,   93},
+	{UINT64_C(0x0004400000000c), 13,   93}, {UINT64_C(0x00044000000011),  8,   95}, {UINT64_C(0x00044000000012),  7,   95},
+	{UINT64_C(0x00044000000014),  6,   95}, {UINT64_C(0x00044000000021), 13,   93}, {UINT64_C(0x00044000000022), 13,   93},
+	{UINT64_C(0x00044000000028),  4,   95}, {UINT64_C(0x00044000000044),  4,   95}, {UINT64_C(0x00044000000101),  4,   95},
+	{UINT64_C(0x00044000000201), 18,   95}, {UINT64_C(0x00044000000202), 13,   93}, {UINT64_C(0x00044000000204), 13,   93},
+	{UINT64_C(0x00044000000210), 13,   93}, {UINT64_C(0x00044000000220), 13,   93}, {UINT64_C(0x00044000000300), 13,   93},
+	{UINT64_C(0x00044000000401), 20,   95}, {UINT64_C(0x00044000000402), 19,   95}, {UINT64_C(0x00044000000404), 18,   95},
+	{UINT64_C(0x00044000000408), 13,   93}, {UINT64_C(0x00044000000410), 13,   93}, {UINT64_C(0x00044000000420), 13,   93},
+	{UINT64_C(0x00044000000440), 13,   93}, {UINT64_C(0x00044000000480), 13,   93}, {UINT64_C(0x00044000000500), 13,   93},
+	{UINT64_C(0x00044000000600), 13,   93}, {UINT64_C(0x00044000001400), 13,   93}, {UINT64_C(0x00044000002001), 26,   95},
+	{UINT64_C(0x00044000002002), 25,   95}, {UINT64_C(0x00044000002004), 24,   95}, {UINT64_C(0x00044000002010), 22,   95},
+	{UINT64_C(0x00044000002200), 17,   95}, {UINT64_C(0x00044000002400), 16,   95}, {UINT64_C(0x00044000004200), 13,   93},
+	{UINT64_C(0x00044000004400), 13,   93}, {UINT64_C(0x00044000005000), 13,   95}, {UINT64_C(0x00044000020200), 13,   95},
+	{UINT64_C(0x00044000040001),  9,   95}, {UINT64_C(0x00044000040002), 13,   93}, {UINT64_C(0x00044000040004), 10,   95},
+	{UINT64_C(0x00044000040010), 13,   93}, {UINT64_C(0x00044000040020), 13,   93}, {UINT64_C(0x00044000040100), 13,   95},
+	{UINT64_C(0x00044000080002), 10,   95}, {UINT64_C(0x00044000080004), 13,   93}, {UINT64_C(0x00044000080008), 13,   93},
+	{UINT64_C(0x00044000080010), 13,   93}, {UINT64_C(0x00044000080020), 13,   93}, {UINT64_C(0x00044000080040), 13,   93},
+	{UINT64_C(0x00044000080080), 13,   95}, {UINT64_C(0x00044000100004), 13,   93}, {UINT64_C(0x00044000100010), 13,   93},
+	{UINT64_C(0x00044000100040), 13,   95}, {UINT64_C(0x00044000400010), 13,   95}, {UINT64_C(0x00200800000003),  2,   95},
+	{UINT64_C(0x00200800000005),  1,   95}, {UINT64_C(0x0020080000000a), 13,   93}, {UINT64_C(0x0020080000000c), 13,   93},
+	{UINT64_C(0x00200800000011), 13,   93}, {UINT64_C(0x00200800000012),  7,   95}, {UINT64_C(0x00200800000014),  6,   95},
+	{UINT64_C(0x00200800000021), 13,   93}, {UINT64_C(0x00200800000022), 13,   93}, {UINT64_C(0x00200800000024), 13,   93},
+	{UINT64_C(0x00200800000028),  4,   95}, {UINT64_C(0x00200800000030),  3,   95}, {UINT64_C(0x00200800000044),  4,   95},
+	{UINT64_C(0x00200800000060), 13,   93}, {UINT64_C(0x002008000000a0), 13,   93}, {UINT64_C(0x00200800000210), 13,   93},
+	{UINT64_C(0x00200800000220), 13,   93}, {UINT64_C(0x00200800000408), 13,   93}, {UINT64_C(0x00200800000410), 13,   93},
+	{UINT64_C(0x00200800000440), 13,   93}, {UINT64_C(0x00200800000480), 13,   93}, {UINT64_C(0x00200800000808), 13,   93},
+	{UINT64_C(0x00200800000840), 13,   93}, {UINT64_C(0x00200800000880), 13,   93}, {UINT64_C(0x00200800001400), 13,   93},
+	{UINT64_C(0x00200800001800), 13,   93}, {UINT64_C(0x00200800002001), 26,   95}, {UINT64_C(0x00200800002002), 25,   95},
+	{UINT64_C(0x00200800002010), 22,   95}, {UINT64_C(0x00200800002020), 21,   95}, {UINT64_C(0x00200800004040), 13,   93},
+	{UINT64_C(0x00200800004080), 13,   93}, {UINT64_C(0x00200800005000), 13,   95}, {UINT64_C(0x00200800008800), 13,   95},
+	{UINT64_C(0x00200800020001), 13,   93}, {UINT64_C(0x00200800020200), 13,   95}, {UINT64_C(0x00200800100040), 13,   95}
+};
@@ -0,0 +1,288 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dcli.cpp
+	DETAILS:	ttt3d-cli, the engine on the command line, for analysis without a display.
+			A console program of its own, built from ttt3dcli.cpp and the engine core
+			(ttt3dengine.cpp, ttt3dmcts.cpp, ttt3deval.cpp, ttt3dsearch.cpp, ttt3ddatabase.cpp, ttt3dbook.cpp,
+			ttt3dbookdata.cpp, ttt3dreport.cpp); it needs no Qt.
+
+			Usage: ttt3d-cli [--size n] [--mcts] [--eval] [-t msecs] [-n nodes] [-j threads] [-d database] [-r report] [-v]
+				--size	board of n x n x n squares, 3 to TTT3D_MAX_SIZE (default 3)
+				--mcts	Monte Carlo tree search instead of negamax; -n counts playouts
+				--eval	count lines instead of searching (see below)
+				-t	time budget per position in milliseconds (default 2000, 0 = none)
+				-n	node budget per position (default 0 = none)
+				-j	search threads (default 1, which is deterministic)
+				-d	solved-position database written by ttt3dsolve (3x3x3 only)
+				-r	write the search report of every position to this file
+					(TTT3DReportSink; CSV if it ends in .csv, JSON lines otherwise)
+				-v	also print the nodes searched and the time taken
+
+	Reads one position per line from stdin and prints one line per position:
+		"move score" for the side to move, or "error message".
+	A position is either
+		n^3 squares in square order (see ttt3dsearch.h), '.' or '-' for an empty square,
+			'x' or '1' for player 1, 'o' or '2' for player 2; blanks and '/' are ignored,
+	or	the squares played so far from the empty board, starting with player 1,
+			separated by blanks or commas.
+	Player 1 moves first, so the side to move follows from the number of stones.
+	A finished game prints move -1 with the score of its end: 0 for a draw,
+		-WinScore (TTT3DEngine::winScore) when the side to move has lost.
+	Empty lines and lines starting with '#' are skipped.
+
+	With --eval nothing is searched. All of stdin is read first, then the lines of every
+		position are counted in one batch by TTT3DBatchEvalN and one line is printed per position:
+		"x wins threats forks o wins threats forks" (see ttt3deval.h), or "error message".
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "ttt3dengine.h"
+#include "ttt3deval.h"
+
+/*
+	Set up the position of line in engine; position is set to it as a board ('.', 'x', 'o').
+	Return 0 on success, otherwise a message saying what is wrong with it.
+*/
+static const char *parsePosition(const std::string &line, TTT3DEngine *engine, std::string *position)
+{
+	static char message[64];
+	int count = engine->size() * engine->size() * engine->size();
+
+	std::string squares;
+	bool board	= false;
+	bool separated	= false;
+	for (size_t i = 0; i < line.size(); i++)
+	{
+		char c = line[i];
+		if (strchr(" \t/,", c))
+		{
+			separated	= true;
+			continue;
+		}
+		if (strchr(".-xXoO", c))
+			board	= true;
+		squares	+= c;
+	}
+
+	engine->reset();
+
+	if (board || (!separated && (squares.size() == (size_t)count)))
+	{	// a board
+		if (squares.size() != (size_t)count)
+		{
+			sprintf(message, "a board needs %d squares", count);
+			return message;
+		}
+		if (!engine->setBoard(squares.c_str()))
+			return "not a position of a game";
+		for (int i = 0; i < count; i++)
+			squares[i]	= strchr("xX1", squares[i]) ? 'x' : (strchr("oO2", squares[i]) ? 'o' : '.');
+		*position	= squares;
+		return 0;
+	}
+
+	// a list of moves
+	position->assign(count, '.');
+	const char *p = line.c_str();
+	while (*p)
+	{
+		if (strchr(" \t,", *p))
+		{
+			p++;
+			continue;
+		}
+
+		char *end;
+		long pos = strtol(p, &end, 10);
+		if ((end == p) || (pos < 0) || (pos >= count))
+		{
+			sprintf(message, "moves are squares 0 to %d", count - 1);
+			return message;
+		}
+		if ((*position)[pos] != '.')
+			return "square played twice";
+		if (engine->getResult())
+			return "a move after the end of the game";
+
+		(*position)[pos]	= (engine->currentPlayer() == 1) ? 'x' : 'o';
+		engine->makeMove(pos, engine->currentPlayer());
+		p		= end;
+	}
+	return 0;
+}
+
+/*
+	Count the lines of both players in every one of positions, one batch per player,
+		and fill in the line of output each belongs to.
+*/
+template <int N>
+static void evaluatePositions(const std::vector<std::string> &positions, const std::vector<int> &slots,
+	std::vector<std::string> *output)
+{
+	typedef typename TTT3DBatchEvalN<N>::Bitboard Bitboard;
+	int count = positions.size();
+	std::vector<Bitboard> boards[2] = {std::vector<Bitboard>(count + 1), std::vector<Bitboard>(count + 1)};
+	std::vector<uint8_t> counts[2] = {std::vector<uint8_t>(3 * count + 1), std::vector<uint8_t>(3 * count + 1)};
+
+	for (int i = 0; i < count; i++)
+		for (int sq = 0; sq < TTT3DBoard<N>::Squares; sq++)
+			if (positions[i][sq] != '.')
+				boards[positions[i][sq] == 'o'][i]	|= Bitboard(1) << sq;
+
+	TTT3DBatchEvalN<N> eval;
+	for (int side = 0; side < 2; side++)
+		eval.evaluate(count, &boards[side][0], &boards[side ^ 1][0],
+			&counts[side][0], &counts[side][count], &counts[side][2 * count]);
+
+	char buffer[64];
+	for (int i = 0; i < count; i++)
+	{
+		sprintf(buffer, "x %d %d %d o %d %d %d", counts[0][i], counts[0][count + i], counts[0][2 * count + i],
+			counts[1][i], counts[1][count + i], counts[1][2 * count + i]);
+		(*output)[slots[i]]	= buffer;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	int size		= 3;
+	int msecs		= 2000;
+	int64_t nodes		= 0;
+	int threads		= 1;
+	int algorithm		= TTT3DEngine::Negamax;
+	const char *database	= 0;
+	bool verbose		= false;
+	bool evalMode		= false;
+	TTT3DReportSink reportSink;
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		bool hasValue	= i + 1 < argc;
+
+		if ((strcmp(arg, "--size") == 0) && hasValue)
+			size		= atoi(argv[++i]);
+		else if (strcmp(arg, "--mcts") == 0)
+			algorithm	= TTT3DEngine::MonteCarlo;
+		else if (strcmp(arg, "--eval") == 0)
+			evalMode	= true;
+		else if ((strcmp(arg, "-t") == 0) && hasValue)
+			msecs		= atoi(argv[++i]);
+		else if ((strcmp(arg, "-n") == 0) && hasValue)
+			nodes		= atoll(argv[++i]);
+		else if ((strcmp(arg, "-j") == 0) && hasValue)
+			threads		= atoi(argv[++i]);
+		else if ((strcmp(arg, "-d") == 0) && hasValue)
+			database	= argv[++i];
+		else if ((strcmp(arg, "-r") == 0) && hasValue)
+		{
+			const char *fileName	= argv[++i];
+			size_t length		= strlen(fileName);
+			bool csv		= (length > 4) && (strcmp(fileName + length - 4, ".csv") == 0);
+			if (!reportSink.open(fileName, csv ? TTT3DReportSink::Csv : TTT3DReportSink::Json))
+			{
+				fprintf(stderr, "ttt3d-cli: cannot create %s\n", fileName);
+				return 1;
+			}
+		}
+		else if (strcmp(arg, "-v") == 0)
+			verbose	= true;
+		else
+		{
+			fprintf(stderr, "usage: ttt3d-cli [--size n] [--mcts] [--eval] [-t msecs] [-n nodes] [-j threads] [-d database] [-r report] [-v] < positions\n");
+			return 2;
+		}
+	}
+
+	TTT3DEngine *engine = TTT3DEngine::create(size, algorithm);
+	if (!engine)
+	{
+		fprintf(stderr, "ttt3d-cli: boards of size %d to %d only\n", TTT3D_MIN_SIZE, TTT3D_MAX_SIZE);
+		return 2;
+	}
+	if (database && !engine->loadDatabase(database))
+	{
+		fprintf(stderr, "ttt3d-cli: cannot load database %s\n", database);
+		return 1;
+	}
+	engine->setBudget(msecs, nodes);
+	engine->setThreads(threads);
+	engine->setReportSink(&reportSink);
+
+	std::vector<std::string> positions, output;	// --eval: the positions, every line to print
+	std::vector<int> slots;			// line of output of each position
+
+	char buffer[1024];
+	while (fgets(buffer, sizeof(buffer), stdin))
+	{
+		std::string line(buffer);
+		while (!line.empty() && ((line[line.size() - 1] == '\n') || (line[line.size() - 1] == '\r')))
+			line.erase(line.size() - 1);
+		if (line.empty() || (line[0] == '#'))
+			continue;
+
+		std::string position;
+		const char *error = parsePosition(line, engine, &position);
+		if (evalMode)
+		{
+			if (!error)
+			{
+				positions.push_back(position);
+				slots.push_back(output.size());
+			}
+			output.push_back(error ? std::string("error ") + error : std::string());
+			continue;
+		}
+		if (error)
+		{
+			printf("error %s\n", error);
+			continue;
+		}
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		int move	= -1;
+		int score	= 0;
+		int result	= engine->getResult();
+		if (result == 0)
+			move	= engine->think(&score);
+		else if (result != 3)
+			score	= -engine->winScore();		// the player who moved last has won
+
+		if (verbose)
+			printf("%d %d %lld %lld\n", move, score, (long long)engine->nodes(),
+				(long long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+		else
+			printf("%d %d\n", move, score);
+		fflush(stdout);
+	}
+
+	if (evalMode)
+	{
+		switch (size)
+		{
+			case 3:
+				evaluatePositions<3>(positions, slots, &output);
+				break;
+			case 4:
+				evaluatePositions<4>(positions, slots, &output);
+				break;
+#if TTT3D_MAX_SIZE >= 5
+			case 5:
+				evaluatePositions<5>(positions, slots, &output);
+				break;
+#endif
+		}
+		for (size_t i = 0; i < output.size(); i++)
+			printf("%s\n", output[i].c_str());
+	}
+
+	delete engine;
+	return 0;
+}
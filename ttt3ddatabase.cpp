@@ -0,0 +1,239 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3ddatabase.cpp
+	CLASS:		TTT3DDatabase
+	DETAILS:	Solved positions, memory mapped from the file written by ttt3dsolve.
+			On Windows, which has no mmap, the file is read into memory instead.
+*/
+#include "ttt3ddatabase.h"
+#include <cstdio>
+#include <cstring>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+	Constructor
+	Nothing is loaded until open() is called.
+*/
+TTT3DDatabase::TTT3DDatabase()
+{
+	m_data		= 0;
+	m_size		= 0;
+	m_codes		= 0;
+	m_moves		= 0;
+	m_scores	= 0;
+	m_count		= 0;
+}
+
+/*
+	Destructor
+	Closing the file drops the mapping.
+*/
+TTT3DDatabase::~TTT3DDatabase()
+{
+	close();
+}
+
+/*
+	Map the database file into memory.
+	The file is rejected if its magic, version, size or checksum is wrong;
+		the engine then simply searches every position.
+*/
+bool TTT3DDatabase::open(const char *fileName)
+{
+	close();
+
+#ifndef _WIN32
+	int fd	= ::open(fileName, O_RDONLY);
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	if ((fstat(fd, &st) != 0) || (st.st_size < (off_t)sizeof(Header)))
+	{
+		::close(fd);
+		return false;
+	}
+
+	void *map	= mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);			// the mapping stays valid
+	if (map == MAP_FAILED)
+		return false;
+
+	m_data		= (const unsigned char *)map;
+	m_size		= st.st_size;
+#else
+	FILE *file	= fopen(fileName, "rb");
+	if (!file)
+		return false;
+
+	fseek(file, 0, SEEK_END);
+	long fileSize	= ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	unsigned char *buffer = (fileSize >= (long)sizeof(Header)) ? new unsigned char[fileSize] : 0;
+	bool ok	= buffer && (fread(buffer, 1, fileSize, file) == (size_t)fileSize);
+	fclose(file);
+	if (!ok)
+	{
+		delete [] buffer;
+		return false;
+	}
+
+	m_data		= buffer;
+	m_size		= fileSize;
+#endif
+
+	const unsigned char *data	= m_data;
+	int64_t size	= m_size;
+
+	Header header;
+	memcpy(&header, data, sizeof(Header));
+
+	if ((memcmp(header.magic, "T3DB", 4) != 0) || (header.version != Version) ||
+	    (size != (int64_t)sizeof(Header) + (int64_t)header.count * (int64_t)(sizeof(uint64_t) + 2)) ||
+	    (checksum(data + sizeof(Header), size - sizeof(Header)) != header.checksum))
+	{
+		close();
+		return false;
+	}
+
+	m_count		= header.count;
+	m_codes		= (const uint64_t *)(data + sizeof(Header));
+	m_moves		= (const uint8_t *)(m_codes + m_count);
+	m_scores	= (const int8_t *)(m_moves + m_count);
+	return true;
+}
+
+/*
+	Unmap the file.
+*/
+void TTT3DDatabase::close()
+{
+	if (m_data)
+	{
+#ifndef _WIN32
+		munmap((void *)m_data, m_size);
+#else
+		delete [] m_data;
+#endif
+	}
+
+	m_data		= 0;
+	m_size		= 0;
+
+	m_codes		= 0;
+	m_moves		= 0;
+	m_scores	= 0;
+	m_count		= 0;
+}
+
+/*
+	Return true if a database is loaded.
+*/
+bool TTT3DDatabase::isOpen()
+{
+	return m_codes != 0;
+}
+
+/*
+	Number of positions in the database.
+*/
+int TTT3DDatabase::count()
+{
+	return m_count;
+}
+
+/*
+	Look up the position of search.
+	Binary search on the canonical code; the best move is turned back
+		into the orientation of the game.
+	Return false if the position is not in the database.
+*/
+bool TTT3DDatabase::lookup(TTT3DSearch *search, int *move, int *score)
+{
+	if (!m_count)
+		return false;
+
+	int sym;
+	uint64_t code	= search->canonicalCode(&sym);
+
+	uint32_t low	= 0;
+	uint32_t high	= m_count;
+	while (low < high)
+	{
+		uint32_t mid = low + (high - low) / 2;
+		if (m_codes[mid] < code)
+			low	= mid + 1;
+		else
+			high	= mid;
+	}
+
+	if ((low == m_count) || (m_codes[low] != code))
+		return false;
+
+	*move	= TTT3DSearch::fromCanonical(sym, m_moves[low]);
+	*score	= m_scores[low];
+	return true;
+}
+
+/*
+	Write a database file; codes must be sorted in ascending order.
+*/
+bool TTT3DDatabase::write(const char *fileName, const uint64_t *codes, const uint8_t *moves, const int8_t *scores, uint32_t count)
+{
+	Header header;
+	memcpy(header.magic, "T3DB", 4);
+	header.version	= Version;
+	header.count	= count;
+
+	header.checksum	= checksum((const unsigned char *)codes, count * sizeof(uint64_t));
+	header.checksum	= checksum(moves, count, header.checksum);
+	header.checksum	= checksum((const unsigned char *)scores, count, header.checksum);
+
+	FILE *file	= fopen(fileName, "wb");
+	if (!file)
+		return false;
+
+	bool ok = (fwrite(&header, sizeof(Header), 1, file) == 1) &&
+		  (fwrite(codes, sizeof(uint64_t), count, file) == count) &&
+		  (fwrite(moves, 1, count, file) == count) &&
+		  (fwrite(scores, 1, count, file) == count);
+
+	return (fclose(file) == 0) && ok;
+}
+
+/*
+	CRC-32 (the zip/png polynomial) of size bytes at data.
+	Pass the previous result as crc to checksum data that comes in pieces.
+*/
+uint32_t TTT3DDatabase::checksum(const unsigned char *data, int64_t size, uint32_t crc)
+{
+	struct Table
+	{
+		uint32_t entry[256];
+		Table()
+		{
+			for (uint32_t i = 0; i < 256; i++)
+			{
+				uint32_t c = i;
+				for (int k = 0; k < 8; k++)
+					c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+				entry[i] = c;
+			}
+		}
+	};
+	static const Table table;	// built once, even with several threads opening databases
+
+	crc = ~crc;
+	for (int64_t i = 0; i < size; i++)
+		crc = table.entry[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+	return ~crc;
+}
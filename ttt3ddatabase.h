@@ -0,0 +1,53 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3ddatabase.h
+	CLASS:		TTT3DDatabase
+	DETAILS:	Solved positions, memory mapped from the file written by ttt3dsolve.
+			Part of the engine core: standard C++ and POSIX mmap, no Qt.
+*/
+#ifndef			TTT3DDATABASE_H
+#define			TTT3DDATABASE_H
+
+#include		<stddef.h>
+#include		"ttt3dsearch.h"
+
+/* file format (native byte order)
+	Header		magic "T3DB", version, number of positions, CRC-32 of everything after the header
+	uint64_t	code[count]		canonical position codes (TTT3DSearch::canonicalCode), ascending
+	uint8_t		move[count]		best move in the canonical orientation
+	int8_t		score[count]		game value for the side to move, as TTT3DSearch scores it
+*/
+
+class TTT3DDatabase
+{
+public:
+			TTT3DDatabase	();
+			~TTT3DDatabase	();
+	enum				{Version = 1};
+	bool		open		(const char *);
+	void		close		();
+	bool		isOpen		();
+	int		count		();
+	bool		lookup		(TTT3DSearch *, int *, int *);
+	static bool	write		(const char *, const uint64_t *, const uint8_t *, const int8_t *, uint32_t);
+
+private:
+	struct		Header
+	{
+		char		magic[4];
+		uint32_t	version;
+		uint32_t	count;
+		uint32_t	checksum;
+	};
+	static uint32_t	checksum	(const unsigned char *, int64_t, uint32_t = 0);
+
+	const unsigned char *m_data;		// the whole file
+	size_t		m_size;
+	const uint64_t	*m_codes;
+	const uint8_t	*m_moves;
+	const int8_t	*m_scores;
+	uint32_t	m_count;
+};
+#endif
@@ -0,0 +1,378 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dengine.cpp
+	CLASS:		TTT3DEngine, TTT3DEngineN
+	DETAILS:	The game engine without any user interface.
+*/
+#include "ttt3dengine.h"
+#include "ttt3dbook.h"
+#include "ttt3dmcts.h"
+
+/*
+	Destructor
+*/
+TTT3DEngine::~TTT3DEngine()
+{
+}
+
+/*
+	Constructor
+	The game starts on an empty board; searching is single-threaded
+		and limited to 2 seconds per move.
+*/
+template <int N>
+TTT3DEngineN<N>::TTT3DEngineN()
+	: m_stop(false), m_search(&m_hashTable, &m_stop)
+{
+	m_threads	= 1;
+	m_useBook	= true;
+	m_bookHits	= 0;
+	m_nodes		= 0;
+	m_sink		= 0;
+	m_report.clear();
+
+	setBudget(2000, 0);
+}
+
+/*
+	Destructor
+	think() has joined its threads before returning, so only the positions are left.
+*/
+template <int N>
+TTT3DEngineN<N>::~TTT3DEngineN()
+{
+	for (size_t i = 0; i < m_helpers.size(); i++)
+		delete m_helpers[i];
+}
+
+/*
+	Number of squares along each edge of the board.
+*/
+template <int N>
+int TTT3DEngineN<N>::size()
+{
+	return N;
+}
+
+/*
+	Score of a win on the spot; a finished game is worth -winScore() to the side to move.
+*/
+template <int N>
+int TTT3DEngineN<N>::winScore()
+{
+	return TTT3DSearchN<N>::WinScore;
+}
+
+/*
+	Start a new game.
+	The transposition table only lives as long as one game.
+*/
+template <int N>
+void TTT3DEngineN<N>::reset()
+{
+	m_search.reset();
+	m_hashTable.clear();
+	m_bookHits	= 0;
+}
+
+/*
+	Start a new game from the position board, N^3 squares as TTT3DSearchN::setBoard reads them.
+	Return false, leaving the board empty, if board is not a position.
+*/
+template <int N>
+bool TTT3DEngineN<N>::setBoard(const char *board)
+{
+	reset();
+	return m_search.setBoard(board);
+}
+
+/*
+	Play a move of side in the game; the other side is to move next.
+*/
+template <int N>
+void TTT3DEngineN<N>::makeMove(int pos, int side)
+{
+	m_search.makeMove(pos, side);
+}
+
+/*
+	Take back the last move of the game.
+*/
+template <int N>
+void TTT3DEngineN<N>::undoMove()
+{
+	m_search.undoMove();
+}
+
+/*
+	0 = ongoing; 1 = player 1 wins; 2 = player 2 wins; 3 = draw.
+*/
+template <int N>
+int TTT3DEngineN<N>::getResult()
+{
+	return m_search.getResult();
+}
+
+/*
+	Return current player.
+*/
+template <int N>
+int TTT3DEngineN<N>::currentPlayer()
+{
+	return m_search.currentPlayer();
+}
+
+/*
+	Find the best move of the current player; the game itself is left unchanged.
+	The first plies are answered from the opening book,
+		then a position found in the solved-position database is answered from there.
+	Any other is searched with m_threads threads (Lazy SMP):
+		the helpers search the same position in a different order and share
+		the transposition table with the calling thread, whose move is the one returned.
+	With a single thread the search is deterministic.
+	If score is given, it is set to the value of the move for the current player.
+	What was done is kept in report() and handed to the report sink.
+	Only call this while the game is ongoing.
+*/
+template <int N>
+int TTT3DEngineN<N>::think(int *score)
+{
+	int maxInd, value;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	m_nodes		= 0;
+	m_report.clear();
+
+	if (lookup(&maxInd, &value, &m_report.source))
+	{
+		if (m_report.source == TTT3DReport::Book)
+			m_bookHits++;
+	}
+	else
+	{
+		maxInd		= searchPosition(&value);
+		m_nodes		= m_search.nodes();
+		m_search.fillReport(&m_report);
+	}
+
+	m_stop		= false;
+
+	m_report.move	= maxInd;
+	m_report.score	= value;
+	m_report.usecs	= std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	if (m_sink)
+		m_sink->write(m_report);
+
+	if (score)
+		*score	= value;
+	return maxInd;
+}
+
+/*
+	Search the current position, the opponent of the engine to move, while the opponent thinks:
+		without a budget, until stop() is called or the game is solved.
+	Every reply of the opponent ends up in the shared transposition table, so the
+		think() after the opponent's move finds its subtree searched already.
+	Positions the book or the database answers are not searched; nothing is reported.
+*/
+template <int N>
+void TTT3DEngineN<N>::ponder()
+{
+	int move, score, source;
+	if (!lookup(&move, &score, &source))
+	{
+		m_search.setBudget(0, 0);
+		searchPosition(&score);
+		m_search.setBudget(m_msecs, m_nodeBudget);
+	}
+
+	m_stop		= false;
+}
+
+/*
+	Answer the game position from the opening book or the solved-position database;
+		source is set to where the move came from.
+	Return false if neither holds the position: they only know 3x3x3.
+*/
+template <int N>
+bool TTT3DEngineN<N>::lookup(int *, int *, int *)
+{
+	return false;
+}
+
+template <>
+bool TTT3DEngineN<3>::lookup(int *move, int *score, int *source)
+{
+	if (m_useBook && TTT3DBook::lookup(&m_search, move, score))
+		*source	= TTT3DReport::Book;
+	else if (m_database.lookup(&m_search, move, score))
+		*source	= TTT3DReport::Database;
+	else
+		return false;
+	return true;
+}
+
+/*
+	Search the game position with m_threads threads; return the move of the calling thread.
+*/
+template <int N>
+int TTT3DEngineN<N>::searchPosition(int *score)
+{
+	while ((int)m_helpers.size() < m_threads - 1)
+		m_helpers.push_back(new TTT3DSearchN<N>(&m_hashTable, &m_stop));
+
+	for (int i = 0; i < m_threads - 1; i++)
+	{
+		m_helpers[i]->copyPosition(m_search);
+		m_workers.push_back(std::thread(helperSearch, m_helpers[i], i + 1));
+	}
+
+	int move	= m_search.search(0, score);
+
+	m_stop		= true;
+	for (size_t i = 0; i < m_workers.size(); i++)
+		m_workers[i].join();
+	m_workers.clear();
+
+	return move;
+}
+
+/*
+	Lazy SMP helper.
+	Searches its copy of the game position into the shared transposition table
+		until the calling thread of think() sets the shared stop flag; its move is never played.
+*/
+template <int N>
+void TTT3DEngineN<N>::helperSearch(TTT3DSearchN<N> *search, int skew)
+{
+	search->search(skew);
+}
+
+/*
+	Cut the running think() short, it returns the best move found so far, or end ponder().
+	May be called from any thread. The search notices the flag at its next node
+		and unwinds its virtual moves, so the game is left as it was.
+	A stop() while neither is running makes the next one return at once.
+*/
+template <int N>
+void TTT3DEngineN<N>::stop()
+{
+	m_stop		= true;
+}
+
+/*
+	Drop a stop() that came too late, after think() or ponder() had returned,
+		so that it does not cut the next one short.
+*/
+template <int N>
+void TTT3DEngineN<N>::clearStop()
+{
+	m_stop		= false;
+}
+
+/*
+	Set the budget of one search: time in milliseconds and number of nodes.
+	0 means no limit. Whatever the budget, the first iteration always completes.
+*/
+template <int N>
+void TTT3DEngineN<N>::setBudget(int msecs, int64_t nodes)
+{
+	m_msecs		= msecs;
+	m_nodeBudget	= nodes;
+	m_search.setBudget(msecs, nodes);
+}
+
+/*
+	Set the number of search threads, including the calling one; takes effect with the next move.
+	1 (the default) gives a deterministic search.
+*/
+template <int N>
+void TTT3DEngineN<N>::setThreads(int threads)
+{
+	m_threads	= threads < 1 ? 1 : threads;
+}
+
+/*
+	Use the opening book (the default) or search the first plies as well.
+*/
+template <int N>
+void TTT3DEngineN<N>::setBook(bool use)
+{
+	m_useBook	= use;
+}
+
+/*
+	Memory map the solved-position database written by ttt3dsolve.
+	Return false if the file is missing or damaged, or the board is not 3x3x3;
+		every position is then searched.
+*/
+template <int N>
+bool TTT3DEngineN<N>::loadDatabase(const char *fileName)
+{
+	return (N == 3) && m_database.open(fileName);
+}
+
+/*
+	Number of moves of the current game that came from the opening book.
+*/
+template <int N>
+int TTT3DEngineN<N>::bookHits()
+{
+	return m_bookHits;
+}
+
+/*
+	What the last think() did.
+*/
+template <int N>
+const TTT3DReport &TTT3DEngineN<N>::report()
+{
+	return m_report;
+}
+
+/*
+	Write the report of every think() to sink; 0 (the default) writes none.
+	The sink is not owned by the engine.
+*/
+template <int N>
+void TTT3DEngineN<N>::setReportSink(TTT3DReportSink *sink)
+{
+	m_sink	= sink;
+}
+
+/*
+	Nodes searched by the last think() in the calling thread; 0 if it was a lookup.
+*/
+template <int N>
+int64_t TTT3DEngineN<N>::nodes()
+{
+	return m_nodes;
+}
+
+template class TTT3DEngineN<3>;
+template class TTT3DEngineN<4>;
+#if TTT3D_MAX_SIZE >= 5
+template class TTT3DEngineN<5>;
+#endif
+
+/*
+	New engine playing on a size x size x size board with algorithm (Negamax or MonteCarlo),
+		0 if that size is not supported (TTT3D_MIN_SIZE to TTT3D_MAX_SIZE, see ttt3dboard.h).
+*/
+TTT3DEngine *TTT3DEngine::create(int size, int algorithm)
+{
+	bool mcts = algorithm == MonteCarlo;
+	switch (size)
+	{
+		case 3:
+			return mcts ? (TTT3DEngine *)new TTT3DMctsN<3> : new TTT3DEngineN<3>;
+		case 4:
+			return mcts ? (TTT3DEngine *)new TTT3DMctsN<4> : new TTT3DEngineN<4>;
+#if TTT3D_MAX_SIZE >= 5
+		case 5:
+			return mcts ? (TTT3DEngine *)new TTT3DMctsN<5> : new TTT3DEngineN<5>;
+#endif
+	}
+	return 0;
+}
@@ -0,0 +1,98 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dengine.h
+	CLASS:		TTT3DEngine, TTT3DEngineN
+	DETAILS:	The game engine without any user interface: the game position,
+			the opening book, the solved-position database and the search threads.
+			TTT3DEngine is what every user of the engine sees, whatever the size of the board
+			and the algorithm; TTT3DEngineN plays on an NxNxN board by negamax search,
+			TTT3DMctsN (ttt3dmcts.h) by Monte Carlo tree search.
+			Part of the engine core, which only uses standard C++ (C++14) and no Qt;
+			TTT3DNegamax wraps it for the GUI, ttt3dcli for the command line.
+*/
+#ifndef			TTT3DENGINE_H
+#define			TTT3DENGINE_H
+
+#include		<thread>
+#include		<vector>
+#include		"ttt3ddatabase.h"
+
+class TTT3DEngine
+{
+public:
+	virtual		~TTT3DEngine	();
+	enum		Algorithm	{Negamax, MonteCarlo};
+	static TTT3DEngine *create	(int, int = Negamax);
+	virtual int	size		() = 0;
+	virtual int	winScore	() = 0;
+	virtual void	reset		() = 0;
+	virtual bool	setBoard	(const char *) = 0;
+	virtual void	makeMove	(int, int) = 0;
+	virtual void	undoMove	() = 0;
+	virtual int	getResult	() = 0;
+	virtual int	currentPlayer	() = 0;
+	virtual int	think		(int * = 0) = 0;
+	virtual void	ponder		() = 0;
+	virtual void	stop		() = 0;
+	virtual void	clearStop	() = 0;
+	virtual void	setBudget	(int, int64_t = 0) = 0;
+	virtual void	setThreads	(int) = 0;
+	virtual void	setBook		(bool) = 0;
+	virtual bool	loadDatabase	(const char *) = 0;
+	virtual int	bookHits	() = 0;
+	virtual int64_t	nodes		() = 0;
+	virtual const TTT3DReport &report() = 0;
+	virtual void	setReportSink	(TTT3DReportSink *) = 0;
+};
+
+template <int N>
+class TTT3DEngineN : public TTT3DEngine
+{
+public:
+			TTT3DEngineN	();
+			~TTT3DEngineN	();
+	int		size		();
+	int		winScore	();
+	void		reset		();
+	bool		setBoard	(const char *);
+	void		makeMove	(int, int);
+	void		undoMove	();
+	int		getResult	();
+	int		currentPlayer	();
+	int		think		(int * = 0);
+	void		ponder		();
+	void		stop		();
+	void		clearStop	();
+	void		setBudget	(int, int64_t = 0);
+	void		setThreads	(int);
+	void		setBook		(bool);
+	bool		loadDatabase	(const char *);
+	int		bookHits	();
+	int64_t		nodes		();
+	const TTT3DReport &report	();
+	void		setReportSink	(TTT3DReportSink *);
+
+private:
+	bool		lookup		(int *, int *, int *);
+	int		searchPosition	(int *);
+	static void	helperSearch	(TTT3DSearchN<N> *, int);
+
+	TTT3DHashTable	m_hashTable;
+	std::atomic<bool> m_stop;
+	TTT3DSearchN<N>	m_search;		// the game; searched by the thread calling think()
+	std::vector<TTT3DSearchN<N> *> m_helpers;	// Lazy SMP helper positions, m_threads - 1 of them
+	std::vector<std::thread> m_workers;	// threads searching m_helpers during think()
+	TTT3DDatabase	m_database;		// solved positions, if a database is loaded (3x3x3 only)
+
+	int		m_threads;
+	int		m_msecs;		// budget of think()
+	int64_t		m_nodeBudget;
+	bool		m_useBook;
+	int		m_bookHits;		// moves of this game taken from the opening book
+	int64_t		m_nodes;		// nodes searched by the last think()
+	TTT3DReport	m_report;		// what the last think() did
+	TTT3DReportSink	*m_sink;		// receives every report, if set
+};
+#endif
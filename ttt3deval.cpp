@@ -0,0 +1,281 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3deval.cpp
+	CLASS:		TTT3DBatchEvalN
+	DETAILS:	Line counts of many positions at once, scalar and SIMD kernels.
+*/
+#include "ttt3deval.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define			TTT3D_X86_KERNELS
+#include		<immintrin.h>
+#endif
+
+/*
+	Winning lines of each board size, built by the compiler.
+*/
+template <int N>
+static constexpr TTT3DBoard<N> geometry = TTT3DBoard<N>();
+
+/*
+	Counts of count positions, one at a time; the reference for the SIMD kernels.
+*/
+template <int N>
+static void evaluateScalar(int count, const typename TTT3DBoard<N>::Bitboard *own, const typename TTT3DBoard<N>::Bitboard *other,
+	uint8_t *wins, uint8_t *threats, uint8_t *forks)
+{
+	typedef typename TTT3DBoard<N>::Bitboard Bitboard;
+
+	for (int i = 0; i < count; i++)
+	{
+		int won		= 0;
+		int threat	= 0;
+		Bitboard once	= 0;		// squares completing one threat,
+		Bitboard twice	= 0;		// two or more
+
+		for (int l = 0; l < TTT3DBoard<N>::Lines; l++)
+		{
+			Bitboard mask		= geometry<N>.lineMask[l];
+			Bitboard missing	= mask & ~own[i];
+			if (!missing)
+				won++;
+			else if (!(other[i] & mask) && !(missing & (missing - 1)))
+			{
+				threat++;
+				twice	|= once & missing;
+				once	|= missing;
+			}
+		}
+
+		int fork = 0;
+		for (; twice; twice &= twice - 1)
+			fork++;
+
+		wins[i]		= won;
+		threats[i]	= threat;
+		forks[i]	= fork;
+	}
+}
+
+#ifdef TTT3D_X86_KERNELS
+/*
+	The 3x3x3 kernels: one 32-bit lane per position, the lines of TTT3DBoard<3> in turn.
+	A line is won where own covers its mask, a threat where what own misses of it
+		is a single square (missing & (missing - 1) == 0) and other has none of it.
+	Counters go down by the all-ones compare results, so they count up.
+*/
+__attribute__((target("avx2")))
+static void evaluateAvx2(int count, const uint32_t *own, const uint32_t *other,
+	uint8_t *wins, uint8_t *threats, uint8_t *forks)
+{
+	const __m256i zero	= _mm256_setzero_si256();
+	const __m256i ones	= _mm256_set1_epi32(-1);
+	const __m256i nibbles	= _mm256_set1_epi8(0x0F);
+	const __m256i bitCount	= _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	int i = 0;
+
+	for (; i + 8 <= count; i += 8)
+	{
+		__m256i ownBits		= _mm256_loadu_si256((const __m256i *)(own + i));
+		__m256i otherBits	= _mm256_loadu_si256((const __m256i *)(other + i));
+		__m256i won		= zero;
+		__m256i threat		= zero;
+		__m256i once		= zero;
+		__m256i twice		= zero;
+
+		for (int l = 0; l < TTT3DBoard<3>::Lines; l++)
+		{
+			__m256i mask	= _mm256_set1_epi32(geometry<3>.lineMask[l]);
+			__m256i missing	= _mm256_andnot_si256(ownBits, mask);
+			__m256i full	= _mm256_cmpeq_epi32(missing, zero);
+			__m256i open	= _mm256_cmpeq_epi32(_mm256_and_si256(otherBits, mask), zero);
+			__m256i single	= _mm256_cmpeq_epi32(_mm256_and_si256(missing, _mm256_add_epi32(missing, ones)), zero);
+			__m256i isThreat = _mm256_andnot_si256(full, _mm256_and_si256(open, single));
+			__m256i square	= _mm256_and_si256(missing, isThreat);
+
+			won	= _mm256_sub_epi32(won, full);
+			threat	= _mm256_sub_epi32(threat, isThreat);
+			twice	= _mm256_or_si256(twice, _mm256_and_si256(once, square));
+			once	= _mm256_or_si256(once, square);
+		}
+
+		// population count of each lane: per nibble by table, then added up per lane
+		__m256i low	= _mm256_shuffle_epi8(bitCount, _mm256_and_si256(twice, nibbles));
+		__m256i high	= _mm256_shuffle_epi8(bitCount, _mm256_and_si256(_mm256_srli_epi16(twice, 4), nibbles));
+		__m256i bytes	= _mm256_add_epi8(low, high);
+		__m256i fork	= _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, _mm256_set1_epi8(1)), _mm256_set1_epi16(1));
+
+		alignas(32) int32_t lanes[3][8];
+		_mm256_store_si256((__m256i *)lanes[0], won);
+		_mm256_store_si256((__m256i *)lanes[1], threat);
+		_mm256_store_si256((__m256i *)lanes[2], fork);
+		for (int k = 0; k < 8; k++)
+		{
+			wins[i + k]	= lanes[0][k];
+			threats[i + k]	= lanes[1][k];
+			forks[i + k]	= lanes[2][k];
+		}
+	}
+
+	evaluateScalar<3>(count - i, own + i, other + i, wins + i, threats + i, forks + i);
+}
+
+__attribute__((target("sse4.1")))
+static void evaluateSse4(int count, const uint32_t *own, const uint32_t *other,
+	uint8_t *wins, uint8_t *threats, uint8_t *forks)
+{
+	const __m128i zero	= _mm_setzero_si128();
+	const __m128i ones	= _mm_set1_epi32(-1);
+	const __m128i nibbles	= _mm_set1_epi8(0x0F);
+	const __m128i bitCount	= _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	int i = 0;
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128i ownBits		= _mm_loadu_si128((const __m128i *)(own + i));
+		__m128i otherBits	= _mm_loadu_si128((const __m128i *)(other + i));
+		__m128i won		= zero;
+		__m128i threat		= zero;
+		__m128i once		= zero;
+		__m128i twice		= zero;
+
+		for (int l = 0; l < TTT3DBoard<3>::Lines; l++)
+		{
+			__m128i mask	= _mm_set1_epi32(geometry<3>.lineMask[l]);
+			__m128i missing	= _mm_andnot_si128(ownBits, mask);
+			__m128i full	= _mm_cmpeq_epi32(missing, zero);
+			__m128i open	= _mm_cmpeq_epi32(_mm_and_si128(otherBits, mask), zero);
+			__m128i single	= _mm_cmpeq_epi32(_mm_and_si128(missing, _mm_add_epi32(missing, ones)), zero);
+			__m128i isThreat = _mm_andnot_si128(full, _mm_and_si128(open, single));
+			__m128i square	= _mm_and_si128(missing, isThreat);
+
+			won	= _mm_sub_epi32(won, full);
+			threat	= _mm_sub_epi32(threat, isThreat);
+			twice	= _mm_or_si128(twice, _mm_and_si128(once, square));
+			once	= _mm_or_si128(once, square);
+		}
+
+		__m128i low	= _mm_shuffle_epi8(bitCount, _mm_and_si128(twice, nibbles));
+		__m128i high	= _mm_shuffle_epi8(bitCount, _mm_and_si128(_mm_srli_epi16(twice, 4), nibbles));
+		__m128i bytes	= _mm_add_epi8(low, high);
+		__m128i fork	= _mm_madd_epi16(_mm_maddubs_epi16(bytes, _mm_set1_epi8(1)), _mm_set1_epi16(1));
+
+		alignas(16) int32_t lanes[3][4];
+		_mm_store_si128((__m128i *)lanes[0], won);
+		_mm_store_si128((__m128i *)lanes[1], threat);
+		_mm_store_si128((__m128i *)lanes[2], fork);
+		for (int k = 0; k < 4; k++)
+		{
+			wins[i + k]	= lanes[0][k];
+			threats[i + k]	= lanes[1][k];
+			forks[i + k]	= lanes[2][k];
+		}
+	}
+
+	evaluateScalar<3>(count - i, own + i, other + i, wins + i, threats + i, forks + i);
+}
+#endif
+
+/*
+	Run kernel on the positions; only 3x3x3 has SIMD kernels.
+*/
+template <int N>
+static void dispatch(int, int count, const typename TTT3DBoard<N>::Bitboard *own, const typename TTT3DBoard<N>::Bitboard *other,
+	uint8_t *wins, uint8_t *threats, uint8_t *forks)
+{
+	evaluateScalar<N>(count, own, other, wins, threats, forks);
+}
+
+template <>
+void dispatch<3>(int kernel, int count, const uint32_t *own, const uint32_t *other,
+	uint8_t *wins, uint8_t *threats, uint8_t *forks)
+{
+	switch (kernel)
+	{
+#ifdef TTT3D_X86_KERNELS
+		case TTT3DBatchEvalN<3>::Avx2:
+			evaluateAvx2(count, own, other, wins, threats, forks);
+			return;
+		case TTT3DBatchEvalN<3>::Sse4:
+			evaluateSse4(count, own, other, wins, threats, forks);
+			return;
+#endif
+		default:
+			evaluateScalar<3>(count, own, other, wins, threats, forks);
+	}
+}
+
+/*
+	Constructor
+	Uses the best kernel of the processor.
+*/
+template <int N>
+TTT3DBatchEvalN<N>::TTT3DBatchEvalN()
+{
+	m_kernel	= bestKernel();
+}
+
+/*
+	Fastest kernel the processor runs for this board size; detected once.
+*/
+template <int N>
+int TTT3DBatchEvalN<N>::bestKernel()
+{
+#ifdef TTT3D_X86_KERNELS
+	static const int best = (N != 3) ? Scalar :
+		(__builtin_cpu_init(), __builtin_cpu_supports("avx2")) ? Avx2 :
+		__builtin_cpu_supports("sse4.1") ? Sse4 : Scalar;
+	return best;
+#else
+	return Scalar;
+#endif
+}
+
+/*
+	Name of kernel, for the benchmarks.
+*/
+template <int N>
+const char *TTT3DBatchEvalN<N>::kernelName(int kernel)
+{
+	static const char *names[3] = {"scalar", "sse4", "avx2"};
+	return names[kernel];
+}
+
+/*
+	Use kernel, or the best one the processor has if it lacks kernel;
+		to compare the kernels against each other.
+*/
+template <int N>
+void TTT3DBatchEvalN<N>::setKernel(int kernel)
+{
+	m_kernel	= (kernel < Scalar) ? Scalar : ((kernel > bestKernel()) ? bestKernel() : kernel);
+}
+
+/*
+	Kernel in use.
+*/
+template <int N>
+int TTT3DBatchEvalN<N>::kernel() const
+{
+	return m_kernel;
+}
+
+/*
+	Wins, threats and forks of own against other in each of count positions
+		(see the top of ttt3deval.h). Safe to call from several threads at once.
+*/
+template <int N>
+void TTT3DBatchEvalN<N>::evaluate(int count, const Bitboard *own, const Bitboard *other,
+	uint8_t *wins, uint8_t *threats, uint8_t *forks) const
+{
+	dispatch<N>(m_kernel, count, own, other, wins, threats, forks);
+}
+
+template class TTT3DBatchEvalN<3>;
+template class TTT3DBatchEvalN<4>;
+#if TTT3D_MAX_SIZE >= 5
+template class TTT3DBatchEvalN<5>;
+#endif
@@ -0,0 +1,51 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3deval.h
+	CLASS:		TTT3DBatchEvalN, TTT3DBatchEval
+	DETAILS:	Line counts of many positions at once: wins, threats and forks of one side,
+			for analysis tools and as the leaf evaluator of TTT3DMctsN.
+			Part of the engine core, which only uses standard C++ (C++14) and no Qt.
+*/
+#ifndef			TTT3DEVAL_H
+#define			TTT3DEVAL_H
+
+#include		<stdint.h>
+#include		"ttt3dboard.h"
+
+/* batch evaluation
+	The positions come as a structure of arrays: own[i] and other[i] are the bitboards
+		of the side counted and of its opponent in position i, and the counts of
+		position i go to wins[i], threats[i] and forks[i].
+	For every line of TTT3DBoard, the side
+		wins if it owns the whole line,
+		threatens if it owns all squares but one and the opponent none
+			(it wins by playing the empty one),
+	and a fork is an empty square that completes two or more of its threats:
+		the opponent cannot block them all with one move.
+
+	The 3x3x3 kernels use AVX2 (8 positions at a time) or SSE4.1 (4 at a time),
+		whichever the processor has; the choice is made at run time, so one build runs
+		everywhere. Other sizes, other processors and compilers without GCC's target
+		attributes use the scalar loop, which every kernel must match exactly.
+*/
+template <int N>
+class TTT3DBatchEvalN
+{
+public:
+	typedef typename TTT3DBoard<N>::Bitboard Bitboard;
+	enum		Kernel		{Scalar, Sse4, Avx2};
+			TTT3DBatchEvalN	();
+	static int	bestKernel	();
+	static const char *kernelName	(int);
+	void		setKernel	(int);
+	int		kernel		() const;
+	void		evaluate	(int, const Bitboard *, const Bitboard *, uint8_t *, uint8_t *, uint8_t *) const;
+
+private:
+	int		m_kernel;
+};
+
+typedef			TTT3DBatchEvalN<3>	TTT3DBatchEval;
+#endif
@@ -0,0 +1,544 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dmcts.cpp
+	CLASS:		TTT3DMctsN
+	DETAILS:	Monte Carlo tree search player.
+*/
+#include "ttt3dmcts.h"
+#include <algorithm>
+#include <cmath>
+
+/*
+	Winning lines of each board size, built by the compiler.
+*/
+template <int N>
+static constexpr TTT3DBoard<N> geometry = TTT3DBoard<N>();
+
+/*
+	Weight of the exploration term of UCT against the win rate (0 to 1) of a child.
+*/
+static const double exploration = 0.8;
+
+/*
+	Constructor
+	The whole node pool is allocated here, once; searching is single-threaded
+		and limited to 2 seconds per move, as with the negamax engine.
+*/
+template <int N>
+TTT3DMctsN<N>::TTT3DMctsN()
+	: m_stop(false), m_game(0, &m_stop), m_pool(PoolSize), m_used(0), m_full(false), m_playouts(0), m_maxDepth(0)
+{
+	m_threads	= 1;
+	m_nodes		= 0;
+	m_sink		= 0;
+	m_report.clear();
+
+	setBudget(2000, 0);
+}
+
+/*
+	Destructor
+	think() has joined its threads before returning.
+*/
+template <int N>
+TTT3DMctsN<N>::~TTT3DMctsN()
+{
+}
+
+/*
+	Number of squares along each edge of the board.
+*/
+template <int N>
+int TTT3DMctsN<N>::size()
+{
+	return N;
+}
+
+/*
+	Score of a win on the spot, the same as the negamax engine's.
+*/
+template <int N>
+int TTT3DMctsN<N>::winScore()
+{
+	return TTT3DSearchN<N>::WinScore;
+}
+
+/*
+	Start a new game. No tree is kept from one move to the next.
+*/
+template <int N>
+void TTT3DMctsN<N>::reset()
+{
+	m_game.reset();
+}
+
+/*
+	Start a new game from the position board, N^3 squares as TTT3DSearchN::setBoard reads them.
+	Return false, leaving the board empty, if board is not a position.
+*/
+template <int N>
+bool TTT3DMctsN<N>::setBoard(const char *board)
+{
+	return m_game.setBoard(board);
+}
+
+/*
+	Play a move of side in the game; the other side is to move next.
+*/
+template <int N>
+void TTT3DMctsN<N>::makeMove(int pos, int side)
+{
+	m_game.makeMove(pos, side);
+}
+
+/*
+	Take back the last move of the game.
+*/
+template <int N>
+void TTT3DMctsN<N>::undoMove()
+{
+	m_game.undoMove();
+}
+
+/*
+	0 = ongoing; 1 = player 1 wins; 2 = player 2 wins; 3 = draw.
+*/
+template <int N>
+int TTT3DMctsN<N>::getResult()
+{
+	return m_game.getResult();
+}
+
+/*
+	Return current player.
+*/
+template <int N>
+int TTT3DMctsN<N>::currentPlayer()
+{
+	return m_game.currentPlayer();
+}
+
+/*
+	Find the best move of the current player by Monte Carlo tree search;
+		the game itself is left unchanged.
+	The tree is grown from scratch by m_threads threads until the budget is used up
+		(without one, until stop() is called or the node pool is full);
+		the move played is the most visited child of the root.
+	With a single thread and a playout budget the search is deterministic.
+	If score is given, it is set to the value of the move for the current player:
+		WinScore less the stones on the board for a move that wins on the spot,
+		otherwise its win rate scaled to the range of the evaluation, never a proven win.
+	What was done is kept in report() and handed to the report sink.
+	Only call this while the game is ongoing.
+*/
+template <int N>
+int TTT3DMctsN<N>::think(int *score)
+{
+	m_start		= std::chrono::steady_clock::now();
+	m_report.clear();
+
+	Node &root	= m_pool[0];
+	root.visits	= 0;
+	root.score	= 0;
+	root.state	= Leaf;
+	root.move	= 0;
+	root.result	= Ongoing;
+	m_used		= 1;
+	m_full		= false;
+	m_playouts	= 0;
+	m_maxDepth	= 0;
+
+	// expanded even if a stop is pending, so that there always is a move
+	Bitboard board[2] = {m_game.stones(1), m_game.stones(2)};
+	expand(&root, board, m_game.currentPlayer());
+
+	for (int i = 1; i < m_threads; i++)
+		m_workers.push_back(std::thread(&TTT3DMctsN::worker, this, i));
+	worker(0);
+	for (size_t i = 0; i < m_workers.size(); i++)
+		m_workers[i].join();
+	m_workers.clear();
+
+	m_stop		= false;
+
+	// the most visited child; on a tie the first, the one on most lines
+	Node *children	= &m_pool[root.firstChild];
+	int stones	= Squares - root.childCount;
+	int best	= 0;
+	for (int i = 0; i < root.childCount; i++)
+	{
+		if (children[i].visits > children[best].visits)
+			best	= i;
+		m_report.rootMove[i]	= children[i].move;
+		m_report.rootScore[i]	= scoreOf(children[i], stones);
+	}
+
+	int move	= children[best].move;
+	int value	= scoreOf(children[best], stones);
+	m_nodes		= m_playouts;
+
+	m_report.source		= TTT3DReport::Search;
+	m_report.move		= move;
+	m_report.score		= value;
+	m_report.depth		= m_maxDepth;
+	m_report.nodes		= m_nodes;
+	m_report.rootCount	= root.childCount;
+	m_report.usecs		= std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+	if (m_sink)
+		m_sink->write(m_report);
+
+	if (score)
+		*score	= value;
+	return move;
+}
+
+/*
+	The tree is not kept from one move to the next, so there is nothing to search
+		while the opponent thinks; returns at once.
+*/
+template <int N>
+void TTT3DMctsN<N>::ponder()
+{
+	m_stop		= false;
+}
+
+/*
+	Search thread: playouts from the root until the budget is used up or the stop flag is set.
+	thread 0 is the one calling think(); each thread has its own random numbers.
+*/
+template <int N>
+void TTT3DMctsN<N>::worker(int thread)
+{
+	Random random		= {UINT64_C(0x9E3779B97F4A7C15) * (thread + 1)};
+	int rootPlayer		= m_game.currentPlayer();
+	Bitboard rootBoard[2]	= {m_game.stones(1), m_game.stones(2)};
+	Node *path[Squares + 1];
+	int maxDepth		= 0;
+
+	for (int64_t i = 1; !m_stop; i++)
+	{
+		Bitboard board[2]	= {rootBoard[0], rootBoard[1]};
+		int player		= rootPlayer;		// to move at node
+		int depth		= 0;
+		int winner;
+		Node *node		= &m_pool[0];
+		path[0]			= node;
+		node->visits++;
+
+		for (;;)
+		{	// selection, down to a leaf or the end of the game
+			if (node->result == Won)
+			{
+				winner	= player ^ 0x3;
+				break;
+			}
+			if (node->result == Lost)
+			{	// the side to move completes its threat
+				winner	= player;
+				break;
+			}
+			if (node->result == Full)
+			{
+				winner	= 3;
+				break;
+			}
+			if ((node->state.load(std::memory_order_acquire) != Expanded) &&
+				((node->visits < 2) || !expand(node, board, player)))
+			{	// a leaf is expanded on its second visit
+				winner	= playout(board, player, &random);
+				break;
+			}
+
+			node	= select(node);
+			node->visits++;
+			board[player - 1]	|= Bitboard(1) << node->move;
+			player	^= 0x3;
+			path[++depth]	= node;
+		}
+
+		// backup: each node is scored for the side that moved into it
+		int mover	= player ^ 0x3;
+		for (int d = depth; d >= 0; d--, mover ^= 0x3)
+			path[d]->score	+= (winner == 3) ? 1 : ((winner == mover) ? 2 : 0);
+		maxDepth	= std::max(maxDepth, depth);
+
+		int64_t played	= ++m_playouts;
+		if ((m_playoutBudget && (played >= m_playoutBudget)) ||
+			(!m_playoutBudget && !m_msecs && m_full) ||
+			(m_msecs && !(i & 63) &&
+				(std::chrono::steady_clock::now() - m_start >= std::chrono::milliseconds(m_msecs))))
+			m_stop	= true;
+	}
+
+	int deepest	= m_maxDepth;
+	while ((maxDepth > deepest) && !m_maxDepth.compare_exchange_weak(deepest, maxDepth))
+		;
+}
+
+/*
+	Play random moves from board, player to move, to the end of the game; board is changed.
+	Return the winner, 3 for a draw.
+*/
+template <int N>
+int TTT3DMctsN<N>::playout(Bitboard *board, int player, Random *random)
+{
+	int empty[Squares];
+	int count		= 0;
+	Bitboard occupied	= board[0] | board[1];
+	for (int sq = 0; sq < Squares; sq++)
+		if (!(occupied & (Bitboard(1) << sq)))
+			empty[count++]	= sq;
+
+	while (count)
+	{
+		int i		= random->below(count);
+		int sq		= empty[i];
+		empty[i]	= empty[--count];
+
+		board[player - 1]	|= Bitboard(1) << sq;
+		if (completes(board[player - 1], sq))
+			return player;
+		player	^= 0x3;
+	}
+	return 3;
+}
+
+/*
+	Give node a child for every empty square of board, player to move, taken from the pool
+		in the order of TTT3DBoard::squareOrder. The positions after the moves are scored
+		in one batch: the wins of the player, and the threats left to the opponent.
+	Return false if the pool is full or another thread is expanding node right now.
+*/
+template <int N>
+bool TTT3DMctsN<N>::expand(Node *node, const Bitboard *board, int player)
+{
+	int32_t state	= Leaf;
+	if (!node->state.compare_exchange_strong(state, Expanding))
+		return state == Expanded;
+
+	Bitboard occupied	= board[0] | board[1];
+	int squares[Squares];
+	int count		= 0;
+	for (int i = 0; i < Squares; i++)
+		if (!(occupied & (Bitboard(1) << geometry<N>.squareOrder[i])))
+			squares[count++]	= geometry<N>.squareOrder[i];
+
+	int32_t first	= -1;
+	if (m_used.load(std::memory_order_relaxed) + count <= PoolSize)
+		first	= m_used.fetch_add(count);
+	if ((first < 0) || (first + count > PoolSize))
+	{
+		m_full		= true;
+		node->state	= Leaf;
+		return false;
+	}
+
+	Bitboard moved[Squares], opponent[Squares];
+	uint8_t won[Squares], threats[Squares], spare[2][Squares];
+	for (int i = 0; i < count; i++)
+	{
+		moved[i]	= board[player - 1] | (Bitboard(1) << squares[i]);
+		opponent[i]	= board[2 - player];
+	}
+	m_eval.evaluate(count, moved, opponent, won, spare[0], spare[1]);
+	m_eval.evaluate(count, opponent, moved, spare[0], threats, spare[1]);
+
+	for (int i = 0; i < count; i++)
+	{
+		Node &child	= m_pool[first + i];
+		child.visits.store(0, std::memory_order_relaxed);
+		child.score.store(0, std::memory_order_relaxed);
+		child.state.store(Leaf, std::memory_order_relaxed);
+		child.firstChild	= 0;
+		child.childCount	= 0;
+		child.move		= squares[i];
+		if (won[i])
+			child.result	= Won;
+		else if (threats[i])
+			child.result	= Lost;
+		else
+			child.result	= (count == 1) ? Full : Ongoing;
+	}
+
+	node->firstChild	= first;
+	node->childCount	= count;
+	node->state.store(Expanded, std::memory_order_release);
+	return true;
+}
+
+/*
+	Child of an expanded node to walk down to: the first one never visited,
+		otherwise the one with the highest UCT value.
+*/
+template <int N>
+typename TTT3DMctsN<N>::Node *TTT3DMctsN<N>::select(Node *node)
+{
+	Node *children		= &m_pool[node->firstChild];
+	double logVisits	= std::log((double)node->visits.load(std::memory_order_relaxed));
+	Node *best		= children;
+	double bestValue	= -1;
+
+	for (int i = 0; i < node->childCount; i++)
+	{
+		int32_t visits	= children[i].visits.load(std::memory_order_relaxed);
+		if (!visits)
+			return &children[i];
+
+		double value	= children[i].score.load(std::memory_order_relaxed) / (2.0 * visits) +
+			exploration * std::sqrt(logVisits / visits);
+		if (value > bestValue)
+		{
+			best		= &children[i];
+			bestValue	= value;
+		}
+	}
+	return best;
+}
+
+/*
+	Value of the move into child for the side playing it, stones on the board before it.
+*/
+template <int N>
+int TTT3DMctsN<N>::scoreOf(const Node &child, int stones)
+{
+	if (child.result == Won)
+		return TTT3DSearchN<N>::WinScore - (stones + 1);
+	if (child.result == Lost)
+		return -(TTT3DSearchN<N>::WinScore - (stones + 2));
+	if ((child.result == Full) || !child.visits)
+		return 0;
+
+	double rate	= child.score / (2.0 * child.visits);
+	return (int)std::lround((2 * rate - 1) * (TTT3DSearchN<N>::MinWinScore - 1));
+}
+
+/*
+	board, after a move on square pos, owns a whole line through pos.
+*/
+template <int N>
+bool TTT3DMctsN<N>::completes(Bitboard board, int pos)
+{
+	for (int i = 0; i < geometry<N>.squareLineCount[pos]; i++)
+	{
+		Bitboard mask	= geometry<N>.lineMask[geometry<N>.squareLines[pos][i]];
+		if ((board & mask) == mask)
+			return true;
+	}
+	return false;
+}
+
+/*
+	Random number from 0 to count - 1.
+*/
+template <int N>
+int TTT3DMctsN<N>::Random::below(int count)
+{
+	state	^= state >> 12;
+	state	^= state << 25;
+	state	^= state >> 27;
+	return (int)((((state * UINT64_C(0x2545F4914F6CDD1D)) >> 32) * count) >> 32);
+}
+
+/*
+	Cut the running think() short, it returns the most visited move so far.
+	May be called from any thread. A stop() while think() is not running
+		makes the next one return at once.
+*/
+template <int N>
+void TTT3DMctsN<N>::stop()
+{
+	m_stop		= true;
+}
+
+/*
+	Drop a stop() that came too late, after think() had returned,
+		so that it does not cut the next one short.
+*/
+template <int N>
+void TTT3DMctsN<N>::clearStop()
+{
+	m_stop		= false;
+}
+
+/*
+	Set the budget of one search: time in milliseconds and number of playouts.
+	0 means no limit.
+*/
+template <int N>
+void TTT3DMctsN<N>::setBudget(int msecs, int64_t playouts)
+{
+	m_msecs		= msecs;
+	m_playoutBudget	= playouts;
+}
+
+/*
+	Set the number of threads walking the tree, including the calling one;
+		takes effect with the next move. 1 (the default) gives a deterministic search.
+*/
+template <int N>
+void TTT3DMctsN<N>::setThreads(int threads)
+{
+	m_threads	= threads < 1 ? 1 : threads;
+}
+
+/*
+	Every move is searched; there is no opening book to use.
+*/
+template <int N>
+void TTT3DMctsN<N>::setBook(bool)
+{
+}
+
+/*
+	Every position is searched; return false.
+*/
+template <int N>
+bool TTT3DMctsN<N>::loadDatabase(const char *)
+{
+	return false;
+}
+
+/*
+	No move comes from the opening book.
+*/
+template <int N>
+int TTT3DMctsN<N>::bookHits()
+{
+	return 0;
+}
+
+/*
+	What the last think() did; nodes counts playouts, depth the deepest node one started from.
+*/
+template <int N>
+const TTT3DReport &TTT3DMctsN<N>::report()
+{
+	return m_report;
+}
+
+/*
+	Write the report of every think() to sink; 0 (the default) writes none.
+	The sink is not owned by the engine.
+*/
+template <int N>
+void TTT3DMctsN<N>::setReportSink(TTT3DReportSink *sink)
+{
+	m_sink	= sink;
+}
+
+/*
+	Playouts of the last think(), all threads.
+*/
+template <int N>
+int64_t TTT3DMctsN<N>::nodes()
+{
+	return m_nodes;
+}
+
+template class TTT3DMctsN<3>;
+template class TTT3DMctsN<4>;
+#if TTT3D_MAX_SIZE >= 5
+template class TTT3DMctsN<5>;
+#endif
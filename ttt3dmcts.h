@@ -0,0 +1,110 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dmcts.h
+	CLASS:		TTT3DMctsN
+	DETAILS:	Monte Carlo tree search player, an alternative to the negamax engine
+			behind the same TTT3DEngine interface (TTT3DEngine::create(size, MonteCarlo)).
+			Part of the engine core, which only uses standard C++ (C++14) and no Qt.
+*/
+#ifndef			TTT3DMCTS_H
+#define			TTT3DMCTS_H
+
+#include		<thread>
+#include		<vector>
+#include		"ttt3dengine.h"
+#include		"ttt3deval.h"
+
+/* Monte Carlo tree search
+	Every playout walks down the tree from the root, choosing at each node the child
+		with the highest UCT value (its win rate plus an exploration term),
+		expands the leaf it ends at and plays random moves from there to the end of the game;
+		the result is added to every node on the way down.
+	More playouts give a stronger move; the budget of setBudget counts playouts, not nodes.
+
+	The nodes live in a pool allocated once by the constructor; a node is expanded by
+		taking all its children from the pool at once. When the pool is full the leaves
+		are no longer expanded, the playouts go on from them.
+	The children are scored as one batch by TTT3DBatchEvalN: a move that wins ends the game
+		there, and so does one that leaves the opponent a threat, which it then completes.
+
+	With several threads all of them walk the same tree (tree parallelism).
+		The node counters are atomic; a thread counts its visit on the way down,
+		before the result is known, so the others see the node as a loss for a while
+		(virtual loss) and spread out over the tree.
+*/
+template <int N>
+class TTT3DMctsN : public TTT3DEngine
+{
+public:
+	typedef typename TTT3DBoard<N>::Bitboard Bitboard;
+			TTT3DMctsN	();
+			~TTT3DMctsN	();
+	enum				{Squares = TTT3DBoard<N>::Squares, PoolSize = 1 << 20};
+	int		size		();
+	int		winScore	();
+	void		reset		();
+	bool		setBoard	(const char *);
+	void		makeMove	(int, int);
+	void		undoMove	();
+	int		getResult	();
+	int		currentPlayer	();
+	int		think		(int * = 0);
+	void		ponder		();
+	void		stop		();
+	void		clearStop	();
+	void		setBudget	(int, int64_t = 0);
+	void		setThreads	(int);
+	void		setBook		(bool);
+	bool		loadDatabase	(const char *);
+	int		bookHits	();
+	int64_t		nodes		();
+	const TTT3DReport &report	();
+	void		setReportSink	(TTT3DReportSink *);
+
+private:
+	enum		NodeState	{Leaf, Expanding, Expanded};
+	enum		NodeResult	{Ongoing, Won, Lost, Full};
+	struct		Node
+	{
+		std::atomic<int32_t>	visits;		// playouts through the node, running ones included
+		std::atomic<int32_t>	score;		// 2 per win and 1 per draw of the side that moved into it
+		std::atomic<int32_t>	state;		// NodeState; the children may be read once Expanded
+		int32_t		firstChild;		// index in m_pool
+		int16_t		childCount;
+		uint8_t		move;			// square played to reach the node
+		uint8_t		result;			// NodeResult of that move
+	};
+	struct		Random			// xorshift64*, one per thread
+	{
+		uint64_t	state;
+		int		below		(int);
+	};
+
+	void		worker		(int);
+	int		playout		(Bitboard *, int, Random *);
+	bool		expand		(Node *, const Bitboard *, int);
+	Node		*select		(Node *);
+	int		scoreOf		(const Node &, int);
+	static bool	completes	(Bitboard, int);
+
+	std::atomic<bool> m_stop;
+	TTT3DSearchN<N>	m_game;			// the game; only its board is used, it never searches
+	TTT3DBatchEvalN<N> m_eval;		// scores the children of a node being expanded
+	std::vector<Node> m_pool;		// the tree; m_pool[0] is the root
+	std::atomic<int32_t> m_used;		// nodes of m_pool in use
+	std::atomic<bool> m_full;		// a node could not be expanded for lack of room
+	std::atomic<int64_t> m_playouts;	// of the running search, all threads
+	std::atomic<int> m_maxDepth;		// deepest node a playout started from
+	std::vector<std::thread> m_workers;	// helpers walking the tree during think()
+	std::chrono::steady_clock::time_point m_start;
+
+	int		m_threads;
+	int		m_msecs;		// budget of think()
+	int64_t		m_playoutBudget;
+	int64_t		m_nodes;		// playouts of the last think()
+	TTT3DReport	m_report;		// what the last think() did
+	TTT3DReportSink	*m_sink;		// receives every report, if set
+};
+#endif
@@ -8,88 +8,95 @@
 			Inherits from QThread.
 */
 #include "ttt3dnegamax.h"
+#include <QFile>
+#include <QTime>
 
 /*
 	Constructor
 	Initialize all variables to default value.
-	Actual game is stored in m_boardArray.
+	Actual game is stored in m_engine; the board is 3x3x3 and searching starts single-threaded.
 */
 TTT3DNegamax::TTT3DNegamax(QObject *p)
 	: QThread(p)
 {
-	m_unoccupiedSq	= 27;
-	m_currentPlayer	= 1;
-
-	m_boardArray	= new QVector<int>(27);
-	m_undoStack		= new QStack<int>();
-
-	for (int i = 0; i < 27; i++)
-		m_boardArray	->insert(i, BlankSq);
+	m_engine	= TTT3DEngine::create(3);
+	m_algorithm	= TTT3DEngine::Negamax;
+	m_msecs		= 2000;
+	m_nodeBudget	= 0;
+	m_threads	= 1;
+	m_pending	= false;
+	m_busy		= false;
+	m_cancel	= false;
+	m_quit		= false;
+	m_ponder	= false;
+	m_ponderPending	= false;
+	m_pondering	= false;
+	m_player	= 1;
+	m_result	= 0;
+	m_displayDelay	= 2000;
+
+	qRegisterMetaType<TTT3DReport>("TTT3DReport");	// searched() crosses threads
 }
 
 /*
 	Destructor
-	Terminate current thread, safely
+	Ask the thread to leave its loop, cancelling any search, and wait for it.
 */
 TTT3DNegamax::~TTT3DNegamax()
 {
 	mutex.lock();
+	m_quit		= true;
+	m_cancel	= true;
+	m_ponderPending	= false;
+	m_engine->stop();
 	cond.wakeOne();
 	mutex.unlock();
 	wait();
+
+	delete m_engine;
 }
 
 /*
 	Reset all variables to default value.
+	The transposition table only lives as long as one game.
+	A move still being computed for the old game is cancelled first (see stop()).
 */
 void TTT3DNegamax::reset()
 {
-	m_unoccupiedSq	= 27;
-	m_currentPlayer	= 1;
+	QMutexLocker locker(&mutex);
+	cancelMove();
 
-	m_undoStack		->clear();
-	for (int i = 0; i < 27; i++)
-		m_boardArray	->replace(i, BlankSq);
+	m_engine->reset();
+	updateState();
 }
 
 /*
-	Make a move on the board (m_boardArray)
-	If it is called from Negamax function, this make move is virtual
-		and will be restored at the end of the function.
-	Once Negamax has been applied, a real makeMove will be called before
-		returning to the main program; this move will be displayed.
+	Make a real move on the board, the one that is displayed.
 	Once a move has been made, switch player.
+	Pondering ends first: the table keeps what it found about this move.
 */
 void TTT3DNegamax::makeMove(int pos, int side)
 {
-	m_boardArray	->replace(pos, side);
-	m_unoccupiedSq--;
-	m_undoStack	->push(pos);	// for restoration purpose
-	m_currentPlayer ^= 0x3;		// Changing player (1->2; 2->1); bitwise exclusive or with 0x3.
-}
+	QMutexLocker locker(&mutex);
+	stopPondering();
 
-/*
-	Similar to makeMove, but this is undoMove
-	This is only called from within Negamax function.
-*/
-void TTT3DNegamax::undoMove()
-{
-	m_boardArray	->replace(m_undoStack->top(), BlankSq);
-	m_undoStack	->pop();
-	m_unoccupiedSq++;
-	m_currentPlayer ^= 0x3;
+	m_engine->makeMove(pos, side);
+	updateState();
 }
 
 /*
 	Preparing this thread (called from gameboard)
-	Starting this thread with high priority.
+	Starting this thread with high priority the first time;
+		afterwards the same thread is woken up for every move of every game.
 	Setting which side the computer is on.
 */
 void TTT3DNegamax::computerMove(int comp)
 {
 	QMutexLocker locker(&mutex);
+	stopPondering();
 
 	m_computer	= comp;
+	m_pending	= true;
 
 	if(!isRunning())
 		start(HighPriority);
@@ -103,7 +110,10 @@ void TTT3DNegamax::computerMove(int comp)
 */
 bool TTT3DNegamax::checkVictory()
 {
-	int result = getResult();
+	mutex.lock();
+	int result = m_result;
+	mutex.unlock();			// victory() may call stop()
+
 	if (result != 0)
 	{
 		if (result == 1)	// Player 1 wins
@@ -119,138 +129,302 @@ bool TTT3DNegamax::checkVictory()
 
 /*
 	Return current player.
+	Kept apart from the engine, whose board changes all the time while it ponders.
 */
 int TTT3DNegamax::currentPlayer()
 {
-	return m_currentPlayer;
+	QMutexLocker locker(&mutex);
+	return m_player;
 }
 
 /*
-	Terminate the thread.
+	Cancel the move the thread is working on, if any, and wait until it is idle.
+	The search notices the stop flag at its next node and unwinds its virtual moves,
+		so the board is left as it was before computerMove; no move is made and done is not emitted.
+	The thread itself keeps running, waiting for the next computerMove.
 */
 void TTT3DNegamax::stop()
 {
-	terminate();
-	wait();
+	QMutexLocker locker(&mutex);
+	cancelMove();
 }
 
 /*
 	Protected function.
-	For each available move, call Negamax to access the likelihood of a win.
-	Negamax algorithm requires every other level's values to be negative (Min's value),
-		therefore, calling the negative of negamax will always return the negated value
-		and we can just simply search for the maximum value and percolate up the tree.
-	Since this tree is big, I'm limiting the depth that it goes down (6 levels).
+	The thread sleeps on cond until computerMove asks for a move, finds it with the engine,
+		then goes back to sleep; it only leaves the loop when the engine is destroyed.
+	Instead of spinning, the thread waits until the display delay has passed.
+	A move cancelled by stop() is dropped.
+	With pondering on, the thread searches the opponent's position after every move
+		it makes, until the opponent moves.
 */
 void TTT3DNegamax::run()
-{	/*
-		Simple heuristic values.
-		-2 = no play; -1 = loss; 0 = draw; 1 = win; otherwise = score of move i.
-	*/
-	QVector<int> scores(27);
+{
+	QMutexLocker locker(&mutex);
+
+	forever
+	{
+		while (!m_pending && !m_ponderPending && !m_quit)
+			cond.wait(&mutex);
+		if (m_quit)
+			break;
 
-	int cutOff = (27 - m_unoccupiedSq) + 6; // 6 levels depth
-	cutOff = cutOff > 27 ? 27 : cutOff;
+		if (!m_pending)
+		{	// the opponent's turn
+			m_ponderPending	= false;
+			m_pondering	= true;
+			m_busy		= true;
+
+			locker.unlock();
+			m_engine->ponder();
+			locker.relock();
+
+			m_engine->clearStop();		// stopPondering() may have come after the end
+			m_pondering	= false;
+			m_busy		= false;
+			idle.wakeAll();
+			continue;
+		}
 
-	int maxScore = -3;
-	int maxInd = 0;
+		m_pending	= false;
+		m_busy		= true;
+		m_cancel	= false;
 
-	QTime t;
-	t.start();
+		QTime t;
+		t.start();
 
-	for (int i = 0; i < 27; i++)
-	{
-		if (m_boardArray->at(i) == BlankSq)
-		{
-			makeMove(i, m_computer);	// move is virtual
-			scores[i]	= -applyNegamax((27 - m_unoccupiedSq), cutOff);
-			undoMove();
-		}
-		else
-			scores[i]	= -2;
+		locker.unlock();
+		int maxInd	= m_engine->think();
+		locker.relock();
 
-		if (scores[i] > maxScore)
+		// To simulate the effect of computer thinking, without keeping a core busy.
+		int remaining;
+		while (!m_cancel && ((remaining = m_displayDelay - t.elapsed()) > 0))
+			cond.wait(&mutex, remaining);
+
+		if (!m_cancel)
 		{
-			maxScore	= scores[i];
-			maxInd		= i;
+			emit searched(m_engine->report());	// what the engine did to find it.
+			m_engine->makeMove(maxInd, m_computer);	// actual "best" move is made.
+			updateState();
+			emit done(maxInd);			// inform viewboard when it's done.
+
+			m_ponderPending	= m_ponder && !m_result;
 		}
 
-		if (maxScore > 0)
-			break;
+		m_engine->clearStop();			// so may stop()
+		m_busy		= false;
+		idle.wakeAll();
 	}
+}
 
-	// To simulate the effect of computer thinking.
-	while (t.elapsed() < 2000)
-	{}
+/*
+	Set the budget of one search: time in milliseconds and number of nodes.
+	0 means no limit. Whatever the budget, the first iteration always completes.
+*/
+void TTT3DNegamax::setSearchBudget(int msecs, qint64 nodes)
+{
+	QMutexLocker locker(&mutex);
 
-	makeMove(maxInd, m_computer);			// actual "best" move is made.
-	emit done(maxInd);				// inform viewboard when it's done.
+	m_msecs		= msecs;
+	m_nodeBudget	= nodes;
+	m_engine->setBudget(msecs, nodes);
 }
 
 /*
-	Negamax function; called from run().
-	If it still can't determine a win/loss/draw, continue.
+	Set the minimum time in milliseconds between computerMove and done,
+		so that a human can follow the game; 0 replies as soon as the search is over.
 */
-int TTT3DNegamax::applyNegamax(int currDepth, int depthCutOff)
-{	/*
-		Return values:
-		-1 = loss for current player.
-		0 = draw for both players.
-		1 = win for current player.
-	*/
-	int state = getResult();
-
-	if ((state == 1) || (state == 2))
-	{
-		if (m_currentPlayer == state)
-			return 1;
-		else
-			return -1;
-	}
-	else if ((state == 3) || (currDepth > depthCutOff))	// return 0 if it's a draw or exceeded depth limit.
-		return 0;
+void TTT3DNegamax::setDisplayDelay(int msecs)
+{
+	QMutexLocker locker(&mutex);
+	m_displayDelay	= msecs;
+}
 
-	QVector<int> scores(27);
-	int maxScore = -3;
+/*
+	Memory map the solved-position database written by ttt3dsolve.
+	Return false if the file is missing or damaged; every position is then searched.
+	The database only holds 3x3x3 positions; it is loaded again whenever the board goes back to 3x3x3.
+*/
+bool TTT3DNegamax::loadDatabase(const QString &fileName)
+{
+	QMutexLocker locker(&mutex);
 
-	for (int i = 0; i < 27; i++)
-	{
-		if (m_boardArray->at(i) == BlankSq)
-		{
-			makeMove(i, m_currentPlayer);
-			scores[i]	= -applyNegamax(currDepth + 1, depthCutOff);
-			undoMove();
-		}
-		else
-			scores[i]	= -2;
+	m_database	= QFile::encodeName(fileName);
+	return m_engine->loadDatabase(m_database.constData());
+}
 
-		if (scores[i] > maxScore)
-			maxScore	= scores[i];
+/*
+	Play the following games on a size x size x size board; the current game is dropped.
+	The settings carry over to the new board.
+	Return false, leaving the board as it was, if size is not supported (see TTT3DEngine::create).
+*/
+bool TTT3DNegamax::setBoardSize(int size)
+{
+	QMutexLocker locker(&mutex);
+	if (size == m_engine->size())
+		return true;
 
-		if (maxScore > 0)
-			break;
-	}
+	return replaceEngine(size, m_algorithm);
+}
 
-	return maxScore;
+/*
+	Number of squares along each edge of the board.
+*/
+int TTT3DNegamax::boardSize()
+{
+	QMutexLocker locker(&mutex);
+	return m_engine->size();
 }
 
 /*
-	Check board for winning move.
-	If all squares are occupied already, then it's a draw.
-	For each 8 possible winning moves,
-		check to see if all 3 squares have the same value and return that value.
-	If there is still no winning move, return 0 (ongoing).
+	Play the following games with algorithm, TTT3DEngine::Negamax (the default)
+		or TTT3DEngine::MonteCarlo; the current game is dropped.
+	The settings carry over; the node budget counts playouts for Monte Carlo tree search.
 */
-int TTT3DNegamax::getResult()
-{	// 0 = ongoing; 1 = max win; 2 = min win; 3 = draw;
-	if (m_unoccupiedSq == 0)
-		return 3;
-
-	for (int i = 0; i < 49; i++)
-	{ // check scoring board
-		if ((m_boardArray->at(m_scoring[i][0]) != BlankSq) && (m_boardArray->at(m_scoring[i][0]) == m_boardArray->at(m_scoring[i][1])) && (m_boardArray->at(m_scoring[i][1]) == m_boardArray->at(m_scoring[i][2])))
-			return m_boardArray->at(m_scoring[i][0]);
-	}
+void TTT3DNegamax::setAlgorithm(int algorithm)
+{
+	QMutexLocker locker(&mutex);
+	if (algorithm != m_algorithm)
+		replaceEngine(m_engine->size(), algorithm);
+}
+
+/*
+	Algorithm the computer plays with.
+*/
+int TTT3DNegamax::algorithm()
+{
+	QMutexLocker locker(&mutex);
+	return m_algorithm;
+}
+
+/*
+	Swap in a new engine for size and algorithm, cancelling the move in progress
+		and applying the current settings; called with the mutex locked.
+	Return false, keeping the engine, if TTT3DEngine::create does not support size.
+*/
+bool TTT3DNegamax::replaceEngine(int size, int algorithm)
+{
+	TTT3DEngine *engine = TTT3DEngine::create(size, algorithm);
+	if (!engine)
+		return false;
+
+	cancelMove();
+
+	engine->setBudget(m_msecs, m_nodeBudget);
+	engine->setThreads(m_threads);
+	engine->setReportSink(&m_reportSink);		// writes nothing while no file is open
+	if (!m_database.isEmpty())
+		engine->loadDatabase(m_database.constData());
+
+	delete m_engine;
+	m_engine	= engine;
+	m_algorithm	= algorithm;
+	updateState();
+	return true;
+}
+
+/*
+	Also write the report of every computer move to fileName,
+		as CSV if the name ends in .csv and as JSON lines otherwise.
+	An empty name stops writing; return false if the file cannot be created.
+*/
+bool TTT3DNegamax::setReportFile(const QString &fileName)
+{
+	QMutexLocker locker(&mutex);
+	stopPondering();
+	while (m_busy)			// the engine writes to the sink while it thinks
+		idle.wait(&mutex);
+
+	m_engine->setReportSink(0);
+	m_reportSink.close();
+	if (fileName.isEmpty())
+		return true;
+
+	TTT3DReportSink::Format format = fileName.endsWith(".csv", Qt::CaseInsensitive) ? TTT3DReportSink::Csv : TTT3DReportSink::Json;
+	if (!m_reportSink.open(QFile::encodeName(fileName).constData(), format))
+		return false;
+
+	m_engine->setReportSink(&m_reportSink);
+	return true;
+}
+
+/*
+	Search on the opponent's time: after each of its moves the thread keeps searching
+		the position the opponent has to answer, so that the answer to the opponent's move
+		is mostly in the table already when computerMove is called. Off by default.
+*/
+void TTT3DNegamax::setPondering(bool on)
+{
+	QMutexLocker locker(&mutex);
+
+	m_ponder	= on;
+	if (!on)
+		stopPondering();
+}
+
+/*
+	Private function; call with the mutex locked.
+	What stop() does: drop a requested move and cancel the one the thread is working on,
+		searching or waiting out the display delay, and wait until the thread is idle.
+*/
+void TTT3DNegamax::cancelMove()
+{
+	m_pending	= false;
+	stopPondering();
+	if (!m_busy)
+		return;
+
+	m_cancel	= true;
+	m_engine->stop();
+	cond.wakeAll();			// cut the display delay short
+
+	while (m_busy)
+		idle.wait(&mutex);
+}
+
+/*
+	Private function; call with the mutex locked.
+	Drop a pondering request and end the pondering search, if any, waiting until it has.
+*/
+void TTT3DNegamax::stopPondering()
+{
+	m_ponderPending	= false;
+	if (!m_pondering)
+		return;
+
+	m_engine->stop();
+	while (m_busy)
+		idle.wait(&mutex);
+}
+
+/*
+	Private function; call with the mutex locked while the engine is not searching.
+	Copy the player to move and the result of the game out of the engine.
+*/
+void TTT3DNegamax::updateState()
+{
+	m_player	= m_engine->currentPlayer();
+	m_result	= m_engine->getResult();
+}
+
+/*
+	Number of computer moves of the current game that came from the opening book.
+*/
+int TTT3DNegamax::bookHits()
+{
+	QMutexLocker locker(&mutex);
+	return m_engine->bookHits();
+}
+
+/*
+	Set the number of search threads, including this one; takes effect with the next move.
+	1 (the default) gives a deterministic search.
+*/
+void TTT3DNegamax::setThreads(int threads)
+{
+	QMutexLocker locker(&mutex);
 
-	return 0;
+	m_threads	= threads;
+	m_engine->setThreads(threads);
 }
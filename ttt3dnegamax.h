@@ -6,6 +6,8 @@
 	CLASS:		TTT3DNegamax
 	DETAILS:	Negamax.
 			Inherits from QThread
+			Thin Qt adapter around TTT3DEngine, which does the actual work:
+			it runs the engine on its own thread and reports moves with signals.
 */
 #ifndef			TTT3DNEGAMAX_H
 #define			TTT3DNEGAMAX_H
@@ -13,45 +15,11 @@
 #include 		<QMutex>
 #include 		<QThread>
 #include 		<QWaitCondition>
-#include		<QVector>
-#include		<QStack>
-#include		<QTime>
+#include		<QByteArray>
+#include		<QMetaType>
+#include		"ttt3dengine.h"
 
-/* board representation
-	(bottom)	(mid)		(top)
-	level 1		level 2		level 3
-
-	0   9  18	3  12  21	6  15  24
-	1  10  19	4  13  22	7  16  25
-	2  11  20	5  14  23	8  17  26
-
-	Below is a list of winning squares; there are 49 possible wins.
-*/
-
-const int m_scoring[49][3] = {
-	// row & col
-	{0, 1, 2}, 	{3, 4, 5}, 	{6, 7, 8},
-	{9, 10, 11}, 	{12, 13, 14}, 	{15, 16, 17},
-	{18, 19, 20}, 	{21, 22, 23}, 	{24, 25, 26},
-
-	{0, 9, 18},	{1, 10, 19},	{2, 11, 20},
-	{3, 12, 21},	{4, 13, 22},	{5, 14, 23},
-	{6, 15, 24},	{7, 16, 25},	{8, 17, 26},
-
-	{0, 3, 6},	{1, 4, 7},	{2, 5, 8},
-	{9, 12, 15},	{10, 13, 16},	{11, 14, 17},
-	{18, 21, 24},	{19, 22, 25},	{20, 23, 26},
-
-	// diag
-	{0, 10, 20}, 	{18, 10, 2},	{3, 13, 23},
-	{21, 13, 5}, 	{6, 16, 26},	{24, 16, 8},
-
-	{0, 12, 24},	{6, 12, 18},	{6, 4, 2},	{0, 4, 8},
-	{2, 14, 26},	{8, 14, 20},	{20, 22, 24},	{18, 22, 26},
-	{7, 13, 19},	{1, 13, 25},	{9, 13, 17},	{11, 13, 15},
-
-	{0, 13, 26},	{6, 13, 20},	{2, 13, 24},	{8, 13, 18}
-};
+Q_DECLARE_METATYPE(TTT3DReport)
 
 class TTT3DNegamax : public QThread
 {
@@ -60,34 +28,62 @@ class TTT3DNegamax : public QThread
 public:
 			TTT3DNegamax	(QObject *p = 0);
 			~TTT3DNegamax	();
-	enum		SqCube		{BlankSq, MaxSq, MinSq};
 	void		reset		();
 	void		makeMove	(int, int);
-	void		undoMove	();
 	void		computerMove	(int);
 	bool		checkVictory	();
 	int		currentPlayer	();
 	void		stop		();
+	void		setSearchBudget	(int, qint64 = 0);
+	void		setDisplayDelay	(int);
+	void		setThreads	(int);
+	bool		loadDatabase	(const QString &);
+	int		bookHits	();
+	bool		setReportFile	(const QString &);
+	void		setPondering	(bool);
+	bool		setBoardSize	(int);
+	int		boardSize	();
+	void		setAlgorithm	(int);
+	int		algorithm	();
 
 signals:
 	void		done		(int);
 	void		victory		(int);
+	void		searched	(const TTT3DReport &);
 
 protected:
 	void		run		();
 
 private:
-	int		applyNegamax	(int, int);
-	int		getResult	();
+	void		cancelMove	();
+	void		stopPondering	();
+	void		updateState	();
+	bool		replaceEngine	(int, int);
 
 	QMutex		mutex;
-	QWaitCondition	cond;
+	QWaitCondition	cond;			// a move is requested, or the current one is cancelled
+	QWaitCondition	idle;			// the thread has finished or dropped its move
+
+	bool		m_pending;		// computerMove has been called, the thread has not started on it
+	bool		m_busy;			// the thread is working on a move
+	bool		m_cancel;		// stop() was called while busy
+	bool		m_quit;			// the engine is being destroyed
+	bool		m_ponder;		// search on the opponent's time
+	bool		m_ponderPending;	// the opponent is to move, the thread has not started pondering
+	bool		m_pondering;		// the thread is pondering
 
-	QVector<int>	*m_boardArray;
-	QStack<int>	*m_undoStack;
+	TTT3DEngine	*m_engine;		// the game; searched by this thread
+	TTT3DReportSink	m_reportSink;		// report file, if one is set
 
-	int		m_unoccupiedSq;
-	int		m_currentPlayer;
 	int		m_computer;
+	int		m_player;		// player to move and result of the game,
+	int		m_result;		// as the engine had them after the last real move
+	int		m_displayDelay;		// minimum milliseconds per move
+
+	int		m_algorithm;		// TTT3DEngine::Algorithm of m_engine
+	int		m_msecs;		// settings of the engine, carried over to a new engine
+	qint64		m_nodeBudget;
+	int		m_threads;
+	QByteArray	m_database;
 };
 #endif
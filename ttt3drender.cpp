@@ -0,0 +1,181 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3drender.cpp
+	DETAILS:	ttt3d-render, board images of game records, for game reports and regression tests.
+			A program of its own, built from ttt3drender.cpp and cube.cpp with Qt's OpenGL module;
+			it never shows a window, the images are drawn offscreen by Cube::renderImage.
+			It still needs a GL context: on a machine without a display, run it under
+			a virtual X server (Xvfb), where Mesa renders in software.
+
+			Usage: ttt3d-render [--size n] [-p pixels] [-r x,y,z] [-o prefix]
+				--size	board of n x n x n squares, 3 to Cube::MaxSize (default 3)
+				-p	width and height of the images in pixels (default 512)
+				-r	rotation of the view about the x, y and z axis in degrees
+					(default 18.75,22.5,0, the view the GUI starts with)
+				-o	file names start with this (default "ttt3d")
+
+	Reads one game per line from stdin, the squares played from the empty board starting
+		with player 1, separated by blanks or commas (as ttt3d-cli takes them).
+	Writes prefix-G-P.png, the board of game G (from 1) after P moves (0 is the empty board),
+		and prints its name. The last move is outlined in red, and the cells out of its layer
+		are translucent, as the cursor is in the GUI.
+	Empty lines and lines starting with '#' are skipped.
+	One hidden Cube draws every image, so the whole batch shares one GL context and framebuffer.
+	Exits with 1 if a line is not a game or an image cannot be made or written.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <QApplication>
+#include "cube.h"
+
+/*
+	Read the moves of line into moves; return 0 on success, otherwise a message saying
+		what is wrong with it.
+*/
+static const char *parseGame(const std::string &line, int size, std::vector<int> *moves)
+{
+	static char message[64];
+	int count = size * size * size;
+	std::vector<bool> played(count, false);
+
+	moves->clear();
+	const char *text = line.c_str();
+	while (*text)
+	{
+		if ((*text == ' ') || (*text == '\t') || (*text == ',') || (*text == '\r'))
+		{
+			text++;
+			continue;
+		}
+
+		char *end;
+		long square = strtol(text, &end, 10);
+		if (end == text)
+			return "not a list of squares";
+		if ((square < 0) || (square >= count))
+		{
+			sprintf(message, "square %ld is not on the board", square);
+			return message;
+		}
+		if (played[square])
+		{
+			sprintf(message, "square %ld is played twice", square);
+			return message;
+		}
+
+		played[square]	= true;
+		moves->push_back(square);
+		text	= end;
+	}
+	return 0;
+}
+
+/*
+	Render the board of cube as the image of game after ply moves; return false if it fails.
+*/
+static bool writeImage(Cube *cube, int pixels, const QString &prefix, int game, int ply)
+{
+	QImage image	= cube->renderImage(pixels);
+	QString name	= QString("%1-%2-%3.png").arg(prefix).arg(game).arg(ply, 2, 10, QChar('0'));
+
+	if (image.isNull())
+	{
+		fprintf(stderr, "ttt3d-render: no offscreen rendering (framebuffer objects) in this GL\n");
+		return false;
+	}
+	if (!image.save(name))
+	{
+		fprintf(stderr, "ttt3d-render: cannot write %s\n", name.toLocal8Bit().constData());
+		return false;
+	}
+	printf("%s\n", name.toLocal8Bit().constData());
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	QApplication app(argc, argv);
+
+	int size	= 3;
+	int pixels	= 512;
+	double rotation[3] = {18.75, 22.5, 0.0};
+	QString prefix	= "ttt3d";
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		bool hasValue	= i + 1 < argc;
+		bool ok		= true;
+
+		if ((strcmp(arg, "--size") == 0) && hasValue)
+			size		= atoi(argv[++i]);
+		else if ((strcmp(arg, "-p") == 0) && hasValue)
+			pixels		= atoi(argv[++i]);
+		else if ((strcmp(arg, "-r") == 0) && hasValue)
+			ok		= sscanf(argv[++i], "%lf,%lf,%lf", &rotation[0], &rotation[1], &rotation[2]) == 3;
+		else if ((strcmp(arg, "-o") == 0) && hasValue)
+			prefix		= QString::fromLocal8Bit(argv[++i]);
+		else
+			ok		= false;
+
+		if (!ok || (pixels <= 0))
+		{
+			fprintf(stderr, "usage: ttt3d-render [--size n] [-p pixels] [-r x,y,z] [-o prefix]\n");
+			return 2;
+		}
+	}
+
+	if ((size < 3) || (size > Cube::MaxSize))
+	{
+		fprintf(stderr, "ttt3d-render: boards of size %d to %d only\n", 3, (int)Cube::MaxSize);
+		return 2;
+	}
+	if (!QGLFormat::hasOpenGL())
+	{
+		fprintf(stderr, "ttt3d-render: no OpenGL on this display\n");
+		return 1;
+	}
+
+	Cube cube;
+	cube.setSize(size);
+
+	int status	= 0;
+	int game	= 0;
+	std::string line;
+	while (std::getline(std::cin, line))
+	{
+		if (line.empty() || (line[0] == '#'))
+			continue;
+
+		game++;
+		std::vector<int> moves;
+		const char *error = parseGame(line, size, &moves);
+		if (error)
+		{
+			fprintf(stderr, "ttt3d-render: game %d: %s\n", game, error);
+			status	= 1;
+			continue;
+		}
+
+		cube.reset();
+		cube.setRotation(qRound(rotation[0] * 16), qRound(rotation[1] * 16), qRound(rotation[2] * 16));
+		if (!writeImage(&cube, pixels, prefix, game, 0))
+			return 1;
+
+		for (size_t i = 0; i < moves.size(); i++)
+		{
+			int square	= moves[i];
+			cube.setAxis(square / (size * size), square / size % size, square % size);
+			cube.markCube((i & 1) ? Cube::MinCube : Cube::MaxCube);
+			if (!writeImage(&cube, pixels, prefix, game, i + 1))
+				return 1;
+		}
+	}
+	return status;
+}
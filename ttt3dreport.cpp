@@ -0,0 +1,155 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dreport.cpp
+	CLASS:		TTT3DReport, TTT3DReportSink
+	DETAILS:	What one search did, and a sink writing it out as JSON or CSV.
+*/
+#include "ttt3dreport.h"
+#include <cstring>
+
+static const char *sourceNames[3] = {"search", "book", "database"};
+
+/*
+	Empty report: no move, nothing counted.
+*/
+void TTT3DReport::clear()
+{
+	memset(this, 0, sizeof(TTT3DReport));
+	move	= -1;
+}
+
+/*
+	Constructor
+	Nothing is written until open() is called.
+*/
+TTT3DReportSink::TTT3DReportSink()
+{
+	m_file		= 0;
+	m_format	= Json;
+	m_header	= false;
+}
+
+/*
+	Destructor
+*/
+TTT3DReportSink::~TTT3DReportSink()
+{
+	close();
+}
+
+/*
+	Write reports to fileName, "-" for stdout, one line per report:
+		a JSON object, or a CSV row after a header line.
+	Return false if the file cannot be created.
+*/
+bool TTT3DReportSink::open(const char *fileName, Format format)
+{
+	close();
+
+	m_file		= strcmp(fileName, "-") ? fopen(fileName, "w") : stdout;
+	m_format	= format;
+	m_header	= false;
+	return m_file != 0;
+}
+
+/*
+	Close the file; stdout is only flushed.
+*/
+void TTT3DReportSink::close()
+{
+	if (m_file && (m_file != stdout))
+		fclose(m_file);
+	else if (m_file)
+		fflush(m_file);
+	m_file	= 0;
+}
+
+/*
+	Write one report, if a file is open.
+*/
+void TTT3DReportSink::write(const TTT3DReport &report)
+{
+	if (!m_file)
+		return;
+
+	if (m_format == Json)
+		writeJson(m_file, report);
+	else
+	{
+		writeCsv(m_file, report, !m_header);
+		m_header	= true;
+	}
+	fflush(m_file);
+}
+
+/*
+	Report as a JSON object on one line.
+	branching[d] is plyNodes[d + 1] / plyNodes[d], the effective branching factor of that ply.
+*/
+void TTT3DReportSink::writeJson(FILE *file, const TTT3DReport &report)
+{
+	fprintf(file, "{\"source\":\"%s\",\"move\":%d,\"score\":%d,\"depth\":%d,\"nodes\":%lld,\"usecs\":%lld,"
+		"\"hash_probes\":%lld,\"hash_hits\":%lld,\"root\":[",
+		sourceNames[report.source], report.move, report.score, report.depth, (long long)report.nodes,
+		(long long)report.usecs, (long long)report.hashProbes, (long long)report.hashHits);
+
+	for (int i = 0; i < report.rootCount; i++)
+		fprintf(file, "%s{\"move\":%d,\"score\":%d}", i ? "," : "", report.rootMove[i], report.rootScore[i]);
+	fprintf(file, "],\"telemetry\":%s", report.telemetry ? "true" : "false");
+
+	if (report.telemetry)
+	{
+		fprintf(file, ",\"cutoffs\":%lld,\"first_cutoffs\":%lld,\"hash_cutoffs\":%lld,\"result_nsecs\":%lld,\"ply_nodes\":[",
+			(long long)report.cutoffs, (long long)report.firstCutoffs, (long long)report.hashCutoffs,
+			(long long)report.resultNsecs);
+
+		int plies = TTT3DReport::MaxSquares + 1;
+		while ((plies > 0) && !report.plyNodes[plies - 1])
+			plies--;
+		for (int d = 0; d < plies; d++)
+			fprintf(file, "%s%lld", d ? "," : "", (long long)report.plyNodes[d]);
+
+		fprintf(file, "],\"branching\":[");
+		for (int d = 0; d + 1 < plies; d++)
+			fprintf(file, "%s%.3f", d ? "," : "", (double)report.plyNodes[d + 1] / report.plyNodes[d]);
+		fprintf(file, "]");
+	}
+	fprintf(file, "}\n");
+}
+
+/*
+	Report as a CSV row, preceded by the header line if header is true.
+	The lists (root moves, nodes per ply) are one field each, separated by ';'.
+	The telemetry fields are empty when the counters were not compiled in.
+*/
+void TTT3DReportSink::writeCsv(FILE *file, const TTT3DReport &report, bool header)
+{
+	if (header)
+		fprintf(file, "source,move,score,depth,nodes,usecs,hash_probes,hash_hits,root,"
+			"cutoffs,first_cutoffs,hash_cutoffs,result_nsecs,ply_nodes\n");
+
+	fprintf(file, "%s,%d,%d,%d,%lld,%lld,%lld,%lld,", sourceNames[report.source], report.move,
+		report.score, report.depth, (long long)report.nodes, (long long)report.usecs,
+		(long long)report.hashProbes, (long long)report.hashHits);
+
+	for (int i = 0; i < report.rootCount; i++)
+		fprintf(file, "%s%d:%d", i ? ";" : "", report.rootMove[i], report.rootScore[i]);
+
+	if (!report.telemetry)
+	{
+		fprintf(file, ",,,,,\n");
+		return;
+	}
+
+	fprintf(file, ",%lld,%lld,%lld,%lld,", (long long)report.cutoffs, (long long)report.firstCutoffs,
+		(long long)report.hashCutoffs, (long long)report.resultNsecs);
+
+	int plies = TTT3DReport::MaxSquares + 1;
+	while ((plies > 0) && !report.plyNodes[plies - 1])
+		plies--;
+	for (int d = 0; d < plies; d++)
+		fprintf(file, "%s%lld", d ? ";" : "", (long long)report.plyNodes[d]);
+	fprintf(file, "\n");
+}
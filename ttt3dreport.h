@@ -0,0 +1,74 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dreport.h
+	CLASS:		TTT3DReport, TTT3DReportSink
+	DETAILS:	What one search did, and a sink writing it out as JSON or CSV.
+			Part of the engine core, which only uses standard C++ (C++14) and no Qt.
+*/
+#ifndef			TTT3DREPORT_H
+#define			TTT3DREPORT_H
+
+#include		<stdint.h>
+#include		<stdio.h>
+#include		"ttt3dboard.h"
+
+/* telemetry
+	Build with TTT3D_TELEMETRY defined to count, inside the search itself,
+		cutoffs, nodes at every ply and the time spent in getResult.
+	Without it those counters compile to nothing and the report says so;
+		nodes, table probes and the root move scores are always counted.
+*/
+#ifdef TTT3D_TELEMETRY
+#define			TTT3D_COUNT(statement)	statement
+#else
+#define			TTT3D_COUNT(statement)
+#endif
+
+struct TTT3DReport
+{
+	enum				{MaxSquares = TTT3DBoard<TTT3D_MAX_SIZE>::Squares};
+	enum		Source		{Search, Book, Database};
+
+	int		source;
+	int		move;			// move chosen, -1 if none
+	int		score;			// of move, for the side to move
+	int		depth;			// plies of the last completed iteration
+	int64_t		nodes;			// of the thread whose move is played
+	int64_t		usecs;			// from the start to the end of the move
+	int64_t		hashProbes;
+	int64_t		hashHits;
+
+	int		rootCount;		// root moves of the last completed iteration
+	int		rootMove[MaxSquares];
+	int		rootScore[MaxSquares];		// exact for the best move, an upper bound for the others
+
+	bool		telemetry;		// TTT3D_TELEMETRY was defined; the counters below are valid
+	int64_t		cutoffs;		// beta cutoffs in the move loop
+	int64_t		firstCutoffs;		// of these, on the first move tried
+	int64_t		hashCutoffs;		// positions answered by the transposition table
+	int64_t		resultNsecs;		// time spent in getResult
+	int64_t		plyNodes[MaxSquares + 1];		// nodes 1, 2, ... plies ahead of the root, all iterations
+
+	void		clear		();
+};
+
+class TTT3DReportSink
+{
+public:
+			TTT3DReportSink	();
+			~TTT3DReportSink();
+	enum		Format		{Json, Csv};
+	bool		open		(const char *, Format);
+	void		close		();
+	void		write		(const TTT3DReport &);
+	static void	writeJson	(FILE *, const TTT3DReport &);
+	static void	writeCsv	(FILE *, const TTT3DReport &, bool);
+
+private:
+	FILE		*m_file;
+	Format		m_format;
+	bool		m_header;		// the CSV header has been written
+};
+#endif
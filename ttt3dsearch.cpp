@@ -0,0 +1,973 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dsearch.cpp
+	CLASS:		TTT3DHashTable, TTT3DSearchN
+	DETAILS:	Board and negamax search of one search thread.
+*/
+#include "ttt3dsearch.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+/*
+	Winning lines and square to line incidence of each board size, built by the compiler.
+*/
+template <int N>
+static constexpr TTT3DBoard<N> geometry = TTT3DBoard<N>();
+
+/*
+	Zobrist keys, one random number per side and square.
+	The key of a position is the exclusive or of the keys of every occupied square.
+	A fixed seed keeps the keys (and therefore the search) the same from run to run.
+*/
+template <int N>
+static uint64_t zobrist[2][N * N * N];
+
+/*
+	symmetry[s][i] is the square that square i is moved to by symmetry s; inverse undoes it.
+	symZobrist[side][i][s] = zobrist[side][symmetry[s][i]], laid out so that makeMove
+		updates the keys of all 48 symmetric positions from one cache line run.
+*/
+template <int N>
+static int symmetry[48][N * N * N];
+template <int N>
+static int inverse[48][N * N * N];
+template <int N>
+static uint64_t symZobrist[2][N * N * N][48];
+
+template <int N>
+static bool buildTables()
+{
+	const int squares = N * N * N;
+
+	uint64_t seed = UINT64_C(0x9E3779B97F4A7C15);
+	for (int side = 0; side < 2; side++)
+		for (int i = 0; i < squares; i++)
+		{	// splitmix64
+			uint64_t z	= (seed += UINT64_C(0x9E3779B97F4A7C15));
+			z		= (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+			z		= (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+			zobrist<N>[side][i] = z ^ (z >> 31);
+		}
+
+	static const int axisOrder[6][3] = {
+		{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}
+	};
+	for (int s = 0; s < 48; s++)
+	{
+		const int *order = axisOrder[s / 8];
+		int mirror = s % 8;
+
+		for (int i = 0; i < squares; i++)
+		{
+			int from[3] = {i / (N * N), (i / N) % N, i % N};
+			int to[3];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				to[axis] = from[order[axis]];
+				if (mirror & (1 << axis))
+					to[axis] = N - 1 - to[axis];
+			}
+			symmetry<N>[s][i]	= to[0] * N * N + to[1] * N + to[2];
+			inverse<N>[s][symmetry<N>[s][i]] = i;
+		}
+	}
+
+	for (int side = 0; side < 2; side++)
+		for (int i = 0; i < squares; i++)
+			for (int s = 0; s < 48; s++)
+				symZobrist<N>[side][i][s] = zobrist<N>[side][symmetry<N>[s][i]];
+	return true;
+}
+
+/*
+	Build the tables of size N once, even when several threads construct searches at the same time.
+*/
+template <int N>
+static void initTables()
+{
+	static const bool initialized = buildTables<N>();
+	(void)initialized;
+}
+
+/*
+	Constructor
+	Allocate the table on a 64-byte boundary, so that every bucket is one cache line.
+*/
+TTT3DHashTable::TTT3DHashTable()
+{
+	m_memory	= new char[Buckets * sizeof(Bucket) + 63];
+	m_table		= (Bucket *)(((uintptr_t)m_memory + 63) & ~(uintptr_t)63);
+	for (int i = 0; i < Buckets; i++)
+		new (&m_table[i]) Bucket;
+
+	clear();
+}
+
+/*
+	Destructor
+*/
+TTT3DHashTable::~TTT3DHashTable()
+{
+	delete [] m_memory;
+}
+
+/*
+	Empty the table.
+	Only call this while no thread is searching.
+*/
+void TTT3DHashTable::clear()
+{
+	for (int i = 0; i < Buckets; i++)
+		for (int j = 0; j < BucketSize; j++)
+		{
+			m_table[i].entry[j].check.store(0, std::memory_order_relaxed);
+			m_table[i].entry[j].data.store(0, std::memory_order_relaxed);
+		}
+}
+
+/*
+	Look up the position with canonical key.
+	Return false if the position has not been searched yet,
+		otherwise fill in what the table remembers about it.
+*/
+bool TTT3DHashTable::probe(uint64_t key, int *depth, int *bound, int *score, int *move)
+{
+	Bucket *bucket = &m_table[key & (Buckets - 1)];
+
+	for (int i = 0; i < BucketSize; i++)
+	{
+		uint64_t data	= bucket->entry[i].data.load(std::memory_order_relaxed);
+		if ((bucket->entry[i].check.load(std::memory_order_relaxed) ^ data) != key)
+			continue;
+
+		*score		= (int16_t)(data & 0xFFFF);
+		*depth		= (int8_t)((data >> 16) & 0xFF);
+		*bound		= (int)((data >> 24) & 0xFF);
+		*move		= (int8_t)((data >> 32) & 0xFF);
+		return true;
+	}
+
+	return false;
+}
+
+/*
+	Remember the result of searching the position with canonical key.
+	The entry of the same position is overwritten first, then an empty one,
+		otherwise the entry searched to the lowest depth makes room.
+	A move of -1 means no best move is known.
+*/
+void TTT3DHashTable::store(uint64_t key, int depth, int bound, int score, int move)
+{
+	Bucket *bucket	= &m_table[key & (Buckets - 1)];
+	Entry *entry	= &bucket->entry[0];
+	int lowest	= 0x7F;
+
+	for (int i = 0; i < BucketSize; i++)
+	{
+		uint64_t data	= bucket->entry[i].data.load(std::memory_order_relaxed);
+		uint64_t check	= bucket->entry[i].check.load(std::memory_order_relaxed);
+		if (((check ^ data) == key) || ((check | data) == 0))
+		{
+			entry	= &bucket->entry[i];
+			break;
+		}
+
+		int entryDepth	= (int8_t)((data >> 16) & 0xFF);
+		if (entryDepth < lowest)
+		{
+			entry	= &bucket->entry[i];
+			lowest	= entryDepth;
+		}
+	}
+
+	uint64_t data	= (uint64_t)(uint16_t)score
+			| ((uint64_t)(uint8_t)depth << 16)
+			| ((uint64_t)(uint8_t)bound << 24)
+			| ((uint64_t)(uint8_t)move << 32);
+
+	entry->data.store(data, std::memory_order_relaxed);
+	entry->check.store(key ^ data, std::memory_order_relaxed);
+}
+
+/*
+	Constructor
+	hashTable and stop are shared with every other thread searching the same game;
+		setting *stop ends the search of all of them: every node checks it
+		and a stopped search unwinds its virtual moves on the way out.
+*/
+template <int N>
+TTT3DSearchN<N>::TTT3DSearchN(TTT3DHashTable *hashTable, std::atomic<bool> *stop)
+{
+	initTables<N>();
+
+	m_hashTable	= hashTable;
+	m_stop		= stop;
+
+	m_timeBudget	= 0;
+	m_nodeBudget	= 0;
+	m_depthLimit	= 0;
+	m_nodes		= 0;
+	m_hashProbes	= 0;
+	m_hashHits	= 0;
+	m_depth		= 0;
+	m_canAbort	= false;
+	m_start		= std::chrono::steady_clock::now();
+
+	reset();
+}
+
+/*
+	Empty the board.
+*/
+template <int N>
+void TTT3DSearchN<N>::reset()
+{
+	m_unoccupiedSq	= Squares;
+	m_currentPlayer	= 1;
+
+	m_board[0]	= 0;
+	m_board[1]	= 0;
+	m_occupied	= 0;
+	m_undoTop	= 0;
+
+	m_completeLines[0] = 0;
+	m_completeLines[1] = 0;
+	memset(m_lineCount, 0, sizeof(m_lineCount));
+
+	for (int s = 0; s < Symmetries; s++)
+		m_symKey[s]	= 0;
+}
+
+/*
+	Set up a position given as N^3 squares in square order: '.' or '-' for an empty square,
+		'x' or '1' for player 1 (MaxSq), 'o' or '2' for player 2 (MinSq).
+	Player 1 moves first, so the side to move follows from the number of stones.
+	Return false, leaving the board empty, if board is not such a position.
+*/
+template <int N>
+bool TTT3DSearchN<N>::setBoard(const char *board)
+{
+	int stones[2][Squares];
+	int count[2] = {0, 0};
+
+	reset();
+	for (int i = 0; i < Squares; i++)
+	{
+		char c = board[i];
+		if ((c == 'x') || (c == 'X') || (c == '1'))
+			stones[0][count[0]++] = i;
+		else if ((c == 'o') || (c == 'O') || (c == '2'))
+			stones[1][count[1]++] = i;
+		else if ((c != '.') && (c != '-'))
+			return false;
+	}
+	if (board[Squares] || ((count[0] != count[1]) && (count[0] != count[1] + 1)))
+		return false;
+
+	for (int i = 0; i < count[0]; i++)
+	{
+		makeMove(stones[0][i], MaxSq);
+		if (i < count[1])
+			makeMove(stones[1][i], MinSq);
+	}
+
+	int result = getResult();
+	if (((result == MaxSq) && (count[0] == count[1])) || ((result == MinSq) && (count[0] > count[1])))
+	{	// a move after the end of the game
+		reset();
+		return false;
+	}
+	return true;
+}
+
+/*
+	Take over the board of another search, leaving the table, budget and counters alone.
+	Used to hand the game position to a helper thread.
+*/
+template <int N>
+void TTT3DSearchN<N>::copyPosition(const TTT3DSearchN &other)
+{
+	m_board[0]	= other.m_board[0];
+	m_board[1]	= other.m_board[1];
+	m_occupied	= other.m_occupied;
+	m_undoTop	= other.m_undoTop;
+	m_unoccupiedSq	= other.m_unoccupiedSq;
+	m_currentPlayer	= other.m_currentPlayer;
+
+	m_completeLines[0] = other.m_completeLines[0];
+	m_completeLines[1] = other.m_completeLines[1];
+	memcpy(m_lineCount, other.m_lineCount, sizeof(m_lineCount));
+	memcpy(m_undoStack, other.m_undoStack, sizeof(m_undoStack));
+	memcpy(m_symKey, other.m_symKey, sizeof(m_symKey));
+}
+
+/*
+	Return current player.
+*/
+template <int N>
+int TTT3DSearchN<N>::currentPlayer()
+{
+	return m_currentPlayer;
+}
+
+/*
+	Squares side (MaxSq or MinSq) has played on.
+*/
+template <int N>
+typename TTT3DSearchN<N>::Bitboard TTT3DSearchN<N>::stones(int side)
+{
+	return m_board[side - 1];
+}
+
+/*
+	Set the budget of one search: time in milliseconds and number of nodes.
+	0 means no limit. Whatever the budget, the first iteration always completes.
+*/
+template <int N>
+void TTT3DSearchN<N>::setBudget(int msecs, int64_t nodes)
+{
+	m_timeBudget	= msecs;
+	m_nodeBudget	= nodes;
+}
+
+/*
+	Limit the search to plies moves ahead of the root; 0 (the default) searches to the end of the game.
+	Used for fixed-depth benchmarks; the budget still applies.
+*/
+template <int N>
+void TTT3DSearchN<N>::setDepth(int plies)
+{
+	m_depthLimit	= plies;
+}
+
+/*
+	Nodes visited by the last search.
+*/
+template <int N>
+int64_t TTT3DSearchN<N>::nodes()
+{
+	return m_nodes;
+}
+
+/*
+	Plies searched by the last completed iteration of the last search.
+*/
+template <int N>
+int TTT3DSearchN<N>::depth()
+{
+	return m_depth;
+}
+
+/*
+	Transposition table probes and hits of the last search.
+*/
+template <int N>
+int64_t TTT3DSearchN<N>::hashProbes()
+{
+	return m_hashProbes;
+}
+
+template <int N>
+int64_t TTT3DSearchN<N>::hashHits()
+{
+	return m_hashHits;
+}
+
+/*
+	Fill in what the last search did; move, score, source and time are left to the caller.
+*/
+template <int N>
+void TTT3DSearchN<N>::fillReport(TTT3DReport *report)
+{
+	report->depth		= m_depth;
+	report->nodes		= m_nodes;
+	report->hashProbes	= m_hashProbes;
+	report->hashHits	= m_hashHits;
+
+	report->rootCount	= m_depth ? m_rootCount : 0;
+	memcpy(report->rootMove, m_rootMove, sizeof(m_rootMove));
+	memcpy(report->rootScore, m_rootScore, sizeof(m_rootScore));
+
+#ifdef TTT3D_TELEMETRY
+	report->telemetry	= true;
+#endif
+	report->cutoffs		= m_cutoffs;
+	report->firstCutoffs	= m_firstCutoffs;
+	report->hashCutoffs	= m_hashCutoffs;
+	report->resultNsecs	= m_resultNsecs;
+	memcpy(report->plyNodes, m_plyNodes, sizeof(m_plyNodes));
+}
+
+/*
+	Milliseconds since the last search started.
+*/
+template <int N>
+int64_t TTT3DSearchN<N>::elapsed()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+/*
+	Iterative deepening: search the root again and again, one level deeper each time,
+		until the game is solved, the depth limit is reached, the budget runs out
+		or another thread sets *m_stop.
+	Return the best move of the last completed iteration; an iteration that is
+		cut short is thrown away.
+	Helper threads pass a skew > 0: odd ones start one level deeper and every one
+		searches the root moves in a different order, so that the threads spread out
+		over the tree and fill the shared table for each other.
+	If score is given, it is set to the score of the move returned.
+*/
+template <int N>
+int TTT3DSearchN<N>::search(int skew, int *score)
+{
+	int moves[Squares];
+	int rootDepth	= Squares - m_unoccupiedSq;
+
+	orderMoves(moves);
+	int maxInd	= moves[0];	// in case not even one iteration completes
+	int maxScore	= 0;
+	int lastCutOff	= m_depthLimit ? std::min(rootDepth + m_depthLimit, (int)Squares) : Squares;
+
+	m_nodes		= 0;
+	m_hashProbes	= 0;
+	m_hashHits	= 0;
+	m_depth		= 0;
+	m_rootPly	= rootDepth;
+	m_rootCount	= 0;
+	m_canAbort	= false;
+	m_start		= std::chrono::steady_clock::now();
+
+	m_cutoffs	= 0;
+	m_firstCutoffs	= 0;
+	m_hashCutoffs	= 0;
+	m_resultNsecs	= 0;
+	memset(m_plyNodes, 0, sizeof(m_plyNodes));
+
+	for (int cutOff = rootDepth + 1 + (skew & 1); cutOff <= lastCutOff; cutOff++)
+	{
+		int move;
+		int value = searchRoot(cutOff, maxInd, skew, &move);
+		if (*m_stop)
+			break;
+
+		maxInd		= move;
+		maxScore	= value;
+		m_depth		= cutOff - rootDepth;
+		m_canAbort	= true;
+		m_rootCount	= m_iterationCount;	// orderMoves changes the order from one iteration to the next
+		memcpy(m_rootMove, m_iterationMove, sizeof(m_rootMove));
+		memcpy(m_rootScore, m_iterationScore, sizeof(m_rootScore));
+
+		if ((value >= MinWinScore) || (value <= -MinWinScore))	// game solved
+			break;
+	}
+
+	if (score)
+		*score	= maxScore;
+	return maxInd;
+}
+
+/*
+	Perft: play every sequence of up to plies moves from the current position,
+		every empty square in turn and no symmetry reduction, and count what is reached.
+	counts[d][result] is incremented once for every position d + 1 plies ahead,
+		result as getResult() gives it; a finished game is not played on.
+	Only makeMove, undoMove and getResult are involved, so the counts check them
+		against known-good numbers and the time measures them alone.
+*/
+template <int N>
+void TTT3DSearchN<N>::perft(int plies, int64_t (*counts)[4])
+{
+	int player = m_currentPlayer;
+
+	for (int pos = 0; pos < Squares; pos++)
+	{
+		if (m_occupied & (Bitboard(1) << pos))
+			continue;
+
+		makeMove(pos, player);
+		int result = getResult();
+		counts[0][result]++;
+		if ((result == 0) && (plies > 1))
+			perft(plies - 1, counts + 1);
+		undoMove();
+	}
+}
+
+/*
+	Fill moves with the moves of the current player, one per symmetry class,
+		best candidates first, and return how many there are.
+*/
+template <int N>
+int TTT3DSearchN<N>::rootMoves(int *moves)
+{
+	return uniqueMoves(moves, orderMoves(moves));
+}
+
+/*
+	Square that square goes to when the position is turned by symmetry sym.
+*/
+template <int N>
+int TTT3DSearchN<N>::toCanonical(int sym, int square)
+{
+	return symmetry<N>[sym][square];
+}
+
+/*
+	Undo toCanonical: square of the canonical position back in the orientation of the game.
+*/
+template <int N>
+int TTT3DSearchN<N>::fromCanonical(int sym, int square)
+{
+	return inverse<N>[sym][square];
+}
+
+/*
+	Make a move on the board (m_board)
+	If it is called from Negamax function, this make move is virtual
+		and will be restored at the end of the function.
+	Once Negamax has been applied, a real makeMove will be called before
+		returning to the main program; this move will be displayed.
+	The line counters of side are bumped for every line through pos;
+		a line that reaches N is a win.
+	Once a move has been made, switch player.
+*/
+template <int N>
+void TTT3DSearchN<N>::makeMove(int pos, int side)
+{
+	Bitboard bit	= Bitboard(1) << pos;
+	uint8_t *count	= m_lineCount[side - 1];
+
+	for (int i = 0; i < geometry<N>.squareLineCount[pos]; i++)
+		if (++count[geometry<N>.squareLines[pos][i]] == N)
+			m_completeLines[side - 1]++;
+
+	m_board[side - 1]	|= bit;
+	m_occupied	|= bit;
+	m_unoccupiedSq--;
+	for (int s = 0; s < Symmetries; s++)
+		m_symKey[s]	^= symZobrist<N>[side - 1][pos][s];
+	m_undoStack[m_undoTop++] = pos;	// for restoration purpose
+	m_currentPlayer ^= 0x3;		// Changing player (1->2; 2->1); bitwise exclusive or with 0x3.
+}
+
+/*
+	Similar to makeMove, but this is undoMove
+	This is only called from within Negamax function.
+*/
+template <int N>
+void TTT3DSearchN<N>::undoMove()
+{
+	int pos		= m_undoStack[--m_undoTop];
+	Bitboard bit	= Bitboard(1) << pos;
+	int side	= (m_board[0] & bit) ? 0 : 1;
+	uint8_t *count	= m_lineCount[side];
+
+	for (int i = 0; i < geometry<N>.squareLineCount[pos]; i++)
+		if (count[geometry<N>.squareLines[pos][i]]-- == N)
+			m_completeLines[side]--;
+
+	const uint64_t *keys = symZobrist<N>[side][pos];
+	for (int s = 0; s < Symmetries; s++)
+		m_symKey[s]	^= keys[s];
+
+	m_board[0]	&= ~bit;
+	m_board[1]	&= ~bit;
+	m_occupied	&= ~bit;
+	m_unoccupiedSq++;
+	m_currentPlayer ^= 0x3;
+}
+
+/*
+	Check board for winning move.
+	makeMove counts the lines each side owns all N squares of, so this is a lookup.
+	If all squares are occupied and nobody owns a line, then it's a draw.
+	If there is still no winning move, return 0 (ongoing).
+*/
+template <int N>
+int TTT3DSearchN<N>::getResult()
+{	// 0 = ongoing; 1 = max win; 2 = min win; 3 = draw;
+	if (m_completeLines[0])
+		return MaxSq;
+	if (m_completeLines[1])
+		return MinSq;
+
+	if (m_unoccupiedSq == 0)
+		return 3;
+
+	return 0;
+}
+
+/*
+	Positional score of the current position for the current player,
+		used where the search is cut off.
+	Every line only one side has played on is worth geometry<N>.lineValue[squares] to that side.
+	The score always stays below the score of a win.
+*/
+template <int N>
+int TTT3DSearchN<N>::evaluate()
+{
+	const uint8_t *own	= m_lineCount[m_currentPlayer - 1];
+	const uint8_t *other	= m_lineCount[2 - m_currentPlayer];
+	int score		= 0;
+
+	for (int i = 0; i < Lines; i++)
+	{
+		if (!other[i])
+			score	+= geometry<N>.lineValue[own[i]];
+		else if (!own[i])
+			score	-= geometry<N>.lineValue[other[i]];
+	}
+
+	if (score >= MinWinScore)
+		score	= MinWinScore - 1;
+	else if (score <= -MinWinScore)
+		score	= -MinWinScore + 1;
+
+	return score;
+}
+
+/*
+	Search every root move down to depthCutOff, best candidate (first) first.
+	For each available move, call Negamax to access the likelihood of a win.
+	Negamax algorithm requires every other level's values to be negative (Min's value),
+		therefore, calling the negative of negamax will always return the negated value
+		and we can just simply search for the maximum value and percolate up the tree.
+	Moves that a symmetry of the board turns into a move already searched are skipped.
+	A helper thread (skew > 0) rotates the list by skew moves.
+	Return the score of the best move and set bestMove to it.
+*/
+template <int N>
+int TTT3DSearchN<N>::searchRoot(int depthCutOff, int first, int skew, int *bestMove)
+{
+	int moves[Squares];
+	int alpha	= -WinScore;
+	int count	= uniqueMoves(moves, orderMoves(moves, first));
+	int side	= m_currentPlayer;
+
+	if ((skew > 0) && (skew % count))
+	{
+		int rotated[Squares];
+		for (int i = 0; i < count; i++)
+			rotated[i]	= moves[(i + skew) % count];
+		memcpy(moves, rotated, count * sizeof(int));
+	}
+
+	m_iterationCount	= count;
+	memcpy(m_iterationMove, moves, count * sizeof(int));
+
+	*bestMove	= moves[0];
+	for (int i = 0; i < count; i++)
+	{
+		makeMove(moves[i], side);	// move is virtual
+		int score = -applyNegamax((Squares - m_unoccupiedSq), depthCutOff, -WinScore, -alpha);
+		undoMove();
+
+		if (*m_stop)
+			break;
+
+		m_iterationScore[i] = score;
+
+		if (score > alpha)
+		{
+			alpha		= score;
+			*bestMove	= moves[i];
+		}
+	}
+
+	return alpha;
+}
+
+/*
+	Called every 1024 nodes; stop the search of every thread once it is over budget.
+*/
+template <int N>
+void TTT3DSearchN<N>::checkBudget()
+{
+	if (!m_canAbort)
+		return;
+
+	if (((m_timeBudget > 0) && (elapsed() >= m_timeBudget)) ||
+	    ((m_nodeBudget > 0) && (m_nodes >= m_nodeBudget)))
+		*m_stop	= true;
+}
+
+/*
+	Negamax function with alpha-beta pruning; called from searchRoot().
+	If it still can't determine a win/loss/draw, continue.
+	A move that wins on the spot is never searched, neither is a position
+		where the opponent threatens two lines at once.
+	If the opponent threatens a single line, blocking it is the only move tried.
+	Any other position is looked up in the transposition table first,
+		and stored there with the bound its score represents once it is searched.
+*/
+template <int N>
+int TTT3DSearchN<N>::applyNegamax(int currDepth, int depthCutOff, int alpha, int beta)
+{	/*
+		Return values:
+		negative = loss for current player; the sooner the loss, the lower the value.
+		0 = draw for both players.
+		positive = win for current player; the sooner the win, the higher the value.
+		evaluate() = depth limit exceeded; always between the loss and the win values.
+	*/
+	if ((++m_nodes & 1023) == 0)
+		checkBudget();
+	if (*m_stop)
+		return 0;
+
+	TTT3D_COUNT(m_plyNodes[currDepth - m_rootPly - 1]++);
+	TTT3D_COUNT(std::chrono::steady_clock::time_point resultStart = std::chrono::steady_clock::now());
+	int state = getResult();
+	TTT3D_COUNT(m_resultNsecs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - resultStart).count());
+
+	if ((state == 1) || (state == 2))
+	{
+		if (m_currentPlayer == state)
+			return WinScore - currDepth;
+		else
+			return -(WinScore - currDepth);
+	}
+	else if (state == 3)				// return 0 if it's a draw.
+		return 0;
+	else if (currDepth > depthCutOff)		// exceeded depth limit, guess.
+		return evaluate();
+
+	if (threatSquares(m_currentPlayer))			// win on the next move
+		return WinScore - (currDepth + 1);
+
+	Bitboard blocks = threatSquares(m_currentPlayer ^ 0x3);
+	if (blocks & (blocks - 1))				// two threats, only one can be blocked
+		return -(WinScore - (currDepth + 2));
+
+	int moves[Squares];
+	int count, hashMove = -1;
+	int depth = depthCutOff - currDepth;
+	int alphaOrig = alpha;
+	int sym = 0;
+	uint64_t key = 0;
+
+	if (blocks)
+		count = orderMoves(moves);		// orderMoves put the forced block first
+	else
+	{
+		int entryDepth, bound, score, move;
+
+		key = canonicalKey(&sym);
+		m_hashProbes++;
+		if (m_hashTable->probe(key, &entryDepth, &bound, &score, &move))
+		{
+			m_hashHits++;
+			if (entryDepth >= depth)
+			{
+				if (bound == TTT3DHashTable::ExactBound)
+				{
+					TTT3D_COUNT(m_hashCutoffs++);
+					return score;
+				}
+				if ((bound == TTT3DHashTable::LowerBound) && (score > alpha))
+					alpha	= score;
+				else if ((bound == TTT3DHashTable::UpperBound) && (score < beta))
+					beta	= score;
+				if (alpha >= beta)
+				{
+					TTT3D_COUNT(m_hashCutoffs++);
+					return score;
+				}
+			}
+			if (move >= 0)
+				hashMove	= inverse<N>[sym][move];
+		}
+		count = orderMoves(moves, hashMove);
+	}
+
+	if (blocks)
+		count = 1;
+
+	int bestMove = moves[0];
+	for (int i = 0; i < count; i++)
+	{
+		makeMove(moves[i], m_currentPlayer);
+		int score = -applyNegamax(currDepth + 1, depthCutOff, -beta, -alpha);
+		undoMove();
+
+		if (score > alpha)
+		{
+			alpha	= score;
+			bestMove = moves[i];
+		}
+
+		if (alpha >= beta)
+		{
+			TTT3D_COUNT(m_cutoffs++);
+			TTT3D_COUNT(if (i == 0) m_firstCutoffs++);
+			break;
+		}
+	}
+
+	if (*m_stop)
+		return 0;
+
+	if (!blocks)
+	{
+		int bound = TTT3DHashTable::ExactBound;
+		if (alpha <= alphaOrig)
+			bound	= TTT3DHashTable::UpperBound;
+		else if (alpha >= beta)
+			bound	= TTT3DHashTable::LowerBound;
+		m_hashTable->store(key, depth, bound, alpha, symmetry<N>[sym][bestMove]);
+	}
+
+	return alpha;
+}
+
+/*
+	Squares where side would complete a line with its next move.
+	A line is a threat when side owns N - 1 of its N squares and the last one is blank.
+*/
+template <int N>
+typename TTT3DSearchN<N>::Bitboard TTT3DSearchN<N>::threatSquares(int side)
+{
+	const uint8_t *own	= m_lineCount[side - 1];
+	const uint8_t *other	= m_lineCount[2 - side];
+	Bitboard threats		= 0;
+
+	for (int i = 0; i < Lines; i++)
+		if ((own[i] == N - 1) && !other[i])
+			threats	|= geometry<N>.lineMask[i];
+
+	return threats & ~m_occupied;
+}
+
+/*
+	Fill moves with every blank square, best candidates first, and return how many there are.
+	Winning squares of the current player go first, then squares that block the opponent,
+		then the move first (the best move the transposition table remembers, if any),
+		then the rest by the number of lines through them (on 3x3x3: center, corners, face centers, edges).
+*/
+template <int N>
+int TTT3DSearchN<N>::orderMoves(int *moves, int first)
+{
+	Bitboard wins	= threatSquares(m_currentPlayer);
+	Bitboard blocks	= threatSquares(m_currentPlayer ^ 0x3) & ~wins;
+	Bitboard rest	= ~(m_occupied | wins | blocks);
+	int count	= 0;
+
+	if ((first >= 0) && (rest & (Bitboard(1) << first)))
+	{
+		rest		&= ~(Bitboard(1) << first);
+		moves[count++]	= first;
+	}
+
+	const int *order = geometry<N>.squareOrder;
+	for (int i = 0; i < Squares; i++)
+		if (wins & (Bitboard(1) << order[i]))
+			moves[count++] = order[i];
+	for (int i = 0; i < Squares; i++)
+		if (blocks & (Bitboard(1) << order[i]))
+			moves[count++] = order[i];
+	for (int i = 0; i < Squares; i++)
+		if (rest & (Bitboard(1) << order[i]))
+			moves[count++] = order[i];
+
+	return count;
+}
+
+/*
+	Drop the moves of moves[0..count) that a symmetry of the current position
+		maps onto an earlier move of the list, and return how many are left.
+	Only symmetries that leave both bitboards unchanged count.
+*/
+template <int N>
+int TTT3DSearchN<N>::uniqueMoves(int *moves, int count)
+{
+	int stabilizer[48];
+	int symCount = 0;
+
+	for (int s = 0; s < Symmetries; s++)
+	{
+		bool same = true;
+		for (int i = 0; (i < Squares) && same; i++)
+			for (int side = 0; side < 2; side++)
+				if (((m_board[side] >> i) & 1) != ((m_board[side] >> symmetry<N>[s][i]) & 1))
+					same = false;
+		if (same)
+			stabilizer[symCount++] = s;
+	}
+
+	Bitboard seen	= 0;
+	int unique	= 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (seen & (Bitboard(1) << moves[i]))
+			continue;
+		for (int s = 0; s < symCount; s++)
+			seen	|= Bitboard(1) << symmetry<N>[stabilizer[s]][moves[i]];
+		moves[unique++]	= moves[i];
+	}
+
+	return unique;
+}
+
+/*
+	The smallest of the 48 symmetric Zobrist keys of the current position.
+	Every symmetric variant of a position gets the same key this way;
+		sym is set to the symmetry that turns this position into the canonical one.
+*/
+template <int N>
+uint64_t TTT3DSearchN<N>::canonicalKey(int *sym)
+{
+	uint64_t key	= m_symKey[0];
+	*sym		= 0;
+
+	for (int s = 1; s < Symmetries; s++)
+		if (m_symKey[s] < key)
+		{
+			key	= m_symKey[s];
+			*sym	= s;
+		}
+
+	return key;
+}
+
+/*
+	Exact code of the canonical form of the current position: of the 48 symmetric
+		variants, the one whose code (bitboard of side 1, then bitboard of side 2 << 27) is the smallest.
+	sym is set to the symmetry that turns this position into the canonical one.
+	Unlike canonicalKey, two different positions never share a code.
+	3x3x3 only: the two bitboards of a larger board do not fit in 64 bits.
+*/
+template <>
+uint64_t TTT3DSearchN<3>::canonicalCode(int *sym)
+{
+	uint64_t best	= ~UINT64_C(0);
+
+	for (int s = 0; s < Symmetries; s++)
+	{
+		uint64_t code = 0;
+		for (int i = 0; i < 27; i++)
+		{
+			if (m_board[0] & (1u << i))
+				code	|= UINT64_C(1) << symmetry<3>[s][i];
+			else if (m_board[1] & (1u << i))
+				code	|= UINT64_C(1) << (27 + symmetry<3>[s][i]);
+		}
+
+		if (code < best)
+		{
+			best	= code;
+			*sym	= s;
+		}
+	}
+
+	return best;
+}
+
+template class TTT3DSearchN<3>;
+template class TTT3DSearchN<4>;
+#if TTT3D_MAX_SIZE >= 5
+template class TTT3DSearchN<5>;
+#endif
@@ -0,0 +1,161 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dsearch.h
+	CLASS:		TTT3DHashTable, TTT3DSearchN, TTT3DSearch
+	DETAILS:	Board and negamax search of one search thread.
+			Every thread owns a TTT3DSearch; they all share one TTT3DHashTable.
+			The search is a template on the board size N; TTT3DSearch is the 3x3x3 one,
+			the only size the opening book and the solved-position database know.
+			Part of the engine core, which only uses standard C++ (C++14) and no Qt.
+*/
+#ifndef			TTT3DSEARCH_H
+#define			TTT3DSEARCH_H
+
+#include		<stdint.h>
+#include		<atomic>
+#include		<chrono>
+#include		"ttt3dboard.h"
+#include		"ttt3dreport.h"
+
+/* board representation
+	(bottom)	(mid)		(top)
+	level 1		level 2		level 3
+
+	0   9  18	3  12  21	6  15  24
+	1  10  19	4  13  22	7  16  25
+	2  11  20	5  14  23	8  17  26
+
+	Each side owns a bitboard; bit i stands for square i above.
+	Square i sits at (x, y, z) = (i / 9, (i / 3) % 3, i % 3), the same grid Cube uses.
+	Larger boards number their squares the same way (see ttt3dboard.h).
+
+	The cube has 48 symmetries: the 6 orders of the x, y, z axes times
+		the 8 ways of mirroring them (c -> N - 1 - c).
+	Each one maps the winning lines of TTT3DBoard onto themselves, so symmetric positions
+		share their game value; symmetry 0 is the identity.
+*/
+
+/*
+	Transposition table shared by all search threads.
+	An entry remembers the outcome of searching one position; four entries
+		share a 64-byte bucket so that a probe touches a single cache line.
+	Entries are written without locks: the key is stored xor'ed with the data,
+		so an entry torn by two threads writing at once no longer matches any key.
+	Both words are relaxed atomics, so the threads do not race; on x86 they are
+		plain loads and stores.
+*/
+class TTT3DHashTable
+{
+public:
+			TTT3DHashTable	();
+			~TTT3DHashTable	();
+	enum		Bound		{ExactBound, LowerBound, UpperBound};
+	void		clear		();
+	bool		probe		(uint64_t, int *, int *, int *, int *);
+	void		store		(uint64_t, int, int, int, int);
+
+private:
+	enum				{Buckets = 1 << 14, BucketSize = 4};
+	struct		Entry
+	{
+		std::atomic<uint64_t>	check;		// key ^ data; 0 = empty
+		std::atomic<uint64_t>	data;		// score, depth, bound and move packed
+	};
+	struct		Bucket
+	{
+		Entry		entry[BucketSize];
+	};
+
+	char		*m_memory;
+	Bucket		*m_table;		// m_memory aligned to 64 bytes
+};
+
+/*
+	Board and search of an NxNxN game.
+	3x3x3 keeps the scores its database and book were written with; the larger boards
+		need more room between the evaluation and the score of a win.
+*/
+template <int N>
+class TTT3DSearchN
+{
+public:
+	typedef typename TTT3DBoard<N>::Bitboard Bitboard;
+			TTT3DSearchN	(TTT3DHashTable *, std::atomic<bool> *);
+	enum		SqCube		{BlankSq, MaxSq, MinSq};
+	enum				{Size = N, Squares = TTT3DBoard<N>::Squares, Lines = TTT3DBoard<N>::Lines};
+	enum				{WinScore = (N == 3) ? 100 : 1000, MinWinScore = WinScore - Squares, Symmetries = 48};
+	void		reset		();
+	bool		setBoard	(const char *);
+	void		copyPosition	(const TTT3DSearchN &);
+	void		makeMove	(int, int);
+	void		undoMove	();
+	int		getResult	();
+	int		currentPlayer	();
+	Bitboard	stones		(int);
+	void		setBudget	(int, int64_t);
+	void		setDepth	(int);
+	int		search		(int = 0, int * = 0);
+	int64_t		nodes		();
+	int		depth		();
+	int64_t		hashProbes	();
+	int64_t		hashHits	();
+	int64_t		elapsed		();
+	void		fillReport	(TTT3DReport *);
+	int		rootMoves	(int *);
+	void		perft		(int, int64_t (*)[4]);
+	uint64_t	canonicalCode	(int *);
+	static int	toCanonical	(int, int);
+	static int	fromCanonical	(int, int);
+
+private:
+	int		searchRoot	(int, int, int, int *);
+	int		applyNegamax	(int, int, int, int);
+	void		checkBudget	();
+	int		evaluate	();
+	Bitboard	threatSquares	(int);
+	int		orderMoves	(int *, int = -1);
+	int		uniqueMoves	(int *, int);
+	uint64_t	canonicalKey	(int *);
+
+	TTT3DHashTable	*m_hashTable;
+	std::atomic<bool> *m_stop;		// shared by all threads searching the same position
+
+	Bitboard	m_board[2];		// one bitboard per side (MaxSq - 1, MinSq - 1)
+	Bitboard	m_occupied;		// m_board[0] | m_board[1]
+	int		m_undoStack[Squares];
+	int		m_undoTop;
+	uint64_t	m_symKey[Symmetries];	// Zobrist key of the current position under each symmetry
+	uint8_t		m_lineCount[2][Lines];	// squares each side owns on each line of TTT3DBoard
+	int		m_completeLines[2];	// lines each side owns all N squares of
+
+	int		m_unoccupiedSq;
+	int		m_currentPlayer;
+
+	int		m_timeBudget;		// milliseconds per move, 0 = unlimited
+	int64_t		m_nodeBudget;		// nodes per move, 0 = unlimited
+	int		m_depthLimit;		// plies per search, 0 = to the end of the game
+	std::chrono::steady_clock::time_point m_start;
+	int64_t		m_nodes;
+	int64_t		m_hashProbes;
+	int64_t		m_hashHits;
+	int		m_depth;		// plies of the last completed iteration
+	int		m_rootPly;		// stones on the board when the search started
+	int		m_rootCount;		// root moves and their scores, last completed iteration
+	int		m_rootMove[Squares];
+	int		m_rootScore[Squares];
+	int		m_iterationCount;	// root moves and their scores, iteration in progress
+	int		m_iterationMove[Squares];
+	int		m_iterationScore[Squares];
+
+	int64_t		m_cutoffs;		// TTT3D_TELEMETRY counters, see ttt3dreport.h
+	int64_t		m_firstCutoffs;
+	int64_t		m_hashCutoffs;
+	int64_t		m_resultNsecs;
+	int64_t		m_plyNodes[Squares + 1];
+	bool		m_canAbort;		// an iteration has completed
+};
+
+typedef			TTT3DSearchN<3>		TTT3DSearch;
+#endif
@@ -0,0 +1,226 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dsolve.cpp
+	DETAILS:	Offline generator of the solved-position database read by TTT3DDatabase.
+			A console program of its own, built from ttt3dsolve.cpp, ttt3dsearch.cpp,
+			ttt3ddatabase.cpp, ttt3dreport.cpp, ttt3dbook.cpp and ttt3dbookdata.cpp;
+			like the rest of the engine core it needs no Qt.
+
+			Usage: ttt3dsolve [file]			(default ttt3d.db)
+			       ttt3dsolve --book plies [file]	(default 5 ttt3dbookdata.cpp)
+
+	Every reachable position cannot be stored: there are hundreds of billions.
+	What the engine needs is an answer for every position it can actually face,
+		so for each side the generator walks the game tree where that side plays
+		the solved move and the opponent tries every move (one per symmetry class).
+	Each position where the side is to move is solved to the end of the game
+		and stored once under its canonical code.
+	While the position is in the opening book, the side plays the book's move instead,
+		as the engine does; otherwise the walk could take another winning move there
+		and never reach the positions the engine goes on to face.
+		So regenerate the database whenever the book is regenerated.
+
+	With --book, it solves every position with fewer than plies stones instead
+		and writes them out as the C++ source of the opening book (TTT3DBook).
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <vector>
+#include "ttt3dbook.h"
+#include "ttt3ddatabase.h"
+
+struct Solution
+{
+	uint8_t		move;		// canonical orientation
+	int8_t		score;
+};
+
+static std::map<uint64_t, Solution>	solved;
+static std::set<uint64_t>		visited;
+
+/*
+	Walk every position reachable when side plays the solved move
+		(the book's move while the position has fewer stones than the book covers).
+*/
+static void expand(TTT3DSearch *search, int side, int stones)
+{
+	if (search->getResult())
+		return;
+
+	int sym;
+	uint64_t code	= search->canonicalCode(&sym);
+	if (!visited.insert(code).second)
+		return;
+
+	if (search->currentPlayer() == side)
+	{
+		int move;
+		std::map<uint64_t, Solution>::const_iterator it = solved.find(code);
+		if (it != solved.end())
+			move	= TTT3DSearch::fromCanonical(sym, it->second.move);
+		else
+		{
+			int score;
+			if ((stones >= TTT3DBook::plies()) || !TTT3DBook::lookup(search, &move, &score))
+				move	= search->search(0, &score);
+
+			Solution solution;
+			solution.move	= TTT3DSearch::toCanonical(sym, move);
+			solution.score	= score;
+			solved[code]	= solution;
+
+			if (solved.size() % 10000 == 0)
+			{
+				printf("%d positions\r", (int)solved.size());
+				fflush(stdout);
+			}
+		}
+
+		search->makeMove(move, side);
+		expand(search, side, stones + 1);
+		search->undoMove();
+	}
+	else
+	{
+		int moves[27];
+		int count	= search->rootMoves(moves);
+		int player	= search->currentPlayer();
+
+		for (int i = 0; i < count; i++)
+		{
+			search->makeMove(moves[i], player);
+			expand(search, side, stones + 1);
+			search->undoMove();
+		}
+	}
+}
+
+/*
+	Solve every position with fewer than plies stones, whoever is to move.
+*/
+static void expandBook(TTT3DSearch *search, int stones, int plies)
+{
+	if ((stones >= plies) || search->getResult())
+		return;
+
+	int sym;
+	uint64_t code	= search->canonicalCode(&sym);
+	if (!visited.insert(code).second)
+		return;
+
+	int score;
+	int move	= search->search(0, &score);
+
+	Solution solution;
+	solution.move	= TTT3DSearch::toCanonical(sym, move);
+	solution.score	= score;
+	solved[code]	= solution;
+
+	int moves[27];
+	int count	= search->rootMoves(moves);
+	int player	= search->currentPlayer();
+
+	for (int i = 0; i < count; i++)
+	{
+		search->makeMove(moves[i], player);
+		expandBook(search, stones + 1, plies);
+		search->undoMove();
+	}
+}
+
+/*
+	Write the opening book as the source file ttt3dbook.cpp compiles against.
+*/
+static bool writeBook(const char *fileName, int plies)
+{
+	FILE *file = fopen(fileName, "w");
+	if (!file)
+		return false;
+
+	fprintf(file, "/*\r\n");
+	fprintf(file, "\tGenerated by ttt3dsolve --book %d; do not edit.\r\n\r\n", plies);
+	fprintf(file, "\tFILE: \t\tttt3dbookdata.cpp\r\n");
+	fprintf(file, "\tCLASS:\t\tTTT3DBook\r\n");
+	fprintf(file, "\tDETAILS:\tSolved move of every position with fewer than %d stones,\r\n", plies);
+	fprintf(file, "\t\t\t{canonical code, canonical move, score}, sorted by code.\r\n");
+	fprintf(file, "*/\r\n");
+	fprintf(file, "#include \"ttt3dbook.h\"\r\n\r\n");
+	fprintf(file, "const int TTT3DBook::m_plies = %d;\r\n", plies);
+	fprintf(file, "const int TTT3DBook::m_count = %d;\r\n\r\n", (int)solved.size());
+	fprintf(file, "const TTT3DBook::Entry TTT3DBook::m_entries[] = {\r\n");
+
+	int i = 0;
+	for (std::map<uint64_t, Solution>::const_iterator it = solved.begin(); it != solved.end(); ++it, i++)
+		fprintf(file, "%s{UINT64_C(0x%014llx), %2d, %4d}%s", (i % 3) ? " " : "\t",
+			(unsigned long long)it->first, it->second.move, it->second.score,
+			(i + 1 == (int)solved.size()) ? "\r\n" : ((i % 3 == 2) ? ",\r\n" : ","));
+
+	fprintf(file, "};\r\n");
+	return fclose(file) == 0;
+}
+
+/*
+	Seconds since start.
+*/
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+	TTT3DHashTable hashTable;
+	std::atomic<bool> stop(false);
+	TTT3DSearch search(&hashTable, &stop);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	if ((argc > 1) && (strcmp(argv[1], "--book") == 0))
+	{
+		int plies		= argc > 2 ? atoi(argv[2]) : 5;
+		const char *fileName	= argc > 3 ? argv[3] : "ttt3dbookdata.cpp";
+
+		expandBook(&search, 0, plies);
+		if (!writeBook(fileName, plies))
+		{
+			fprintf(stderr, "ttt3dsolve: cannot write %s\n", fileName);
+			return 1;
+		}
+
+		printf("%d positions written to %s in %.1f s\n", (int)solved.size(), fileName, seconds(start));
+		return 0;
+	}
+
+	const char *fileName	= argc > 1 ? argv[1] : "ttt3d.db";
+
+	for (int side = 1; side <= 2; side++)
+	{
+		visited.clear();
+		search.reset();
+		expand(&search, side, 0);
+	}
+
+	std::vector<uint64_t> codes;
+	std::vector<uint8_t> moves;
+	std::vector<int8_t> scores;
+	for (std::map<uint64_t, Solution>::const_iterator it = solved.begin(); it != solved.end(); ++it)
+	{	// std::map keeps the codes sorted
+		codes.push_back(it->first);
+		moves.push_back(it->second.move);
+		scores.push_back(it->second.score);
+	}
+
+	if (!TTT3DDatabase::write(fileName, codes.data(), moves.data(), scores.data(), codes.size()))
+	{
+		fprintf(stderr, "ttt3dsolve: cannot write %s\n", fileName);
+		return 1;
+	}
+
+	printf("%d positions written to %s in %.1f s\n", (int)codes.size(), fileName, seconds(start));
+	return 0;
+}
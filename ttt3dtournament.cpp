@@ -0,0 +1,303 @@
+/*
+	Copyright (C) 2008 by Wai Khoo
+
+	AUTHOR:		Wai Khoo
+	FILE: 		ttt3dtournament.cpp
+	DETAILS:	ttt3d-tournament, headless engine-vs-engine games on a pool of threads,
+			to check the strength and the speed of the engine after a change.
+			A console program of its own, built from ttt3dtournament.cpp and the engine core
+			(ttt3dengine.cpp, ttt3dmcts.cpp, ttt3deval.cpp, ttt3dsearch.cpp, ttt3ddatabase.cpp, ttt3dbook.cpp,
+			ttt3dbookdata.cpp, ttt3dreport.cpp); it needs no Qt.
+
+			Usage: ttt3d-tournament [--size n] [-g games] [-j threads] [-r plies] [-s seed]
+					[-a settings] [-b settings] [-v]
+				--size	board of n x n x n squares, 3 to TTT3D_MAX_SIZE (default 3)
+				-g	number of games (default 1000)
+				-j	games played at once (default: one per core)
+				-r	random plies played before the engines take over (default 2)
+				-s	seed of the random openings (default 1)
+				-a, -b	settings of engine A and B, a comma separated list of
+					t=msecs		time budget per move (default 100, 0 = none)
+					n=nodes		node budget per move (default 0 = none)
+					mcts=0|1	Monte Carlo tree search instead of negamax (default 0);
+							n then counts playouts, book and db are not used
+					j=threads	search threads per move (default 1)
+					book=0|1	use the opening book (default 1)
+					db=file		solved-position database (3x3x3 only)
+				-v	print every game
+
+	Games are played in pairs: both games of a pair start from the same random opening
+		and the engines swap colours, so neither engine profits from a lucky opening.
+	The random plies never end the game; at most 4 are played, a win needs at least 5 stones.
+	Results are counted from engine A's point of view.
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ttt3dengine.h"
+
+struct Settings
+{
+	int		msecs;
+	int64_t		nodes;
+	int		threads;
+	bool		book;
+	int		algorithm;	// TTT3DEngine::Algorithm
+	std::string	database;
+};
+
+struct Results
+{
+	int		wins[2];	// engine A wins as player 1, as player 2
+	int		draws[2];
+	int		losses[2];
+	int		moves;		// engine moves, random plies excluded
+	int64_t		nodes[2];	// nodes searched by engine A, by engine B
+};
+
+static Settings		settings[2];
+static int		size		= 3;
+static int		games		= 1000;
+static int		randomPlies	= 2;
+static unsigned		seed		= 1;
+static bool		verbose		= false;
+
+static std::atomic<int>	nextGame(0);
+static std::mutex	resultsMutex;
+static Results		total;
+
+/*
+	Parse "t=50,n=0,j=1,book=1,mcts=0,db=file" into settings; return false on an unknown key.
+*/
+static bool parseSettings(const char *text, Settings *settings)
+{
+	std::string list(text);
+	size_t start = 0;
+	while (start < list.size())
+	{
+		size_t end = list.find(',', start);
+		if (end == std::string::npos)
+			end	= list.size();
+
+		std::string item	= list.substr(start, end - start);
+		size_t equal		= item.find('=');
+		if (equal == std::string::npos)
+			return false;
+
+		std::string key		= item.substr(0, equal);
+		std::string value	= item.substr(equal + 1);
+		if (key == "t")
+			settings->msecs		= atoi(value.c_str());
+		else if (key == "n")
+			settings->nodes		= atoll(value.c_str());
+		else if (key == "j")
+			settings->threads	= atoi(value.c_str());
+		else if (key == "book")
+			settings->book		= atoi(value.c_str()) != 0;
+		else if (key == "mcts")
+			settings->algorithm	= atoi(value.c_str()) ? TTT3DEngine::MonteCarlo : TTT3DEngine::Negamax;
+		else if (key == "db")
+			settings->database	= value;
+		else
+			return false;
+
+		start	= end + 1;
+	}
+	return true;
+}
+
+/*
+	Set up an engine with settings; return false if its database cannot be loaded.
+*/
+static bool configure(TTT3DEngine *engine, const Settings &settings)
+{
+	engine->setBudget(settings.msecs, settings.nodes);
+	engine->setThreads(settings.threads);
+	engine->setBook(settings.book);
+	return settings.database.empty() || engine->loadDatabase(settings.database.c_str());
+}
+
+/*
+	Random opening of a pair of games; the same pair always gets the same opening.
+*/
+static int randomOpening(int pair, int *moves)
+{
+	std::mt19937 random(seed * 2654435761u + pair);
+	int count = size * size * size;
+	std::vector<int> squares(count);
+	for (int i = 0; i < count; i++)
+		squares[i] = i;
+
+	for (int i = 0; i < randomPlies; i++)
+	{	// partial Fisher-Yates shuffle
+		int j = i + random() % (count - i);
+		std::swap(squares[i], squares[j]);
+		moves[i] = squares[i];
+	}
+	return randomPlies;
+}
+
+/*
+	Worker thread: take the next game until all are played, then add up its results.
+	Each side has its own engine, so each has its own transposition table.
+*/
+static void worker()
+{
+	std::unique_ptr<TTT3DEngine> engines[2] = {	// A, B
+		std::unique_ptr<TTT3DEngine>(TTT3DEngine::create(size, settings[0].algorithm)),
+		std::unique_ptr<TTT3DEngine>(TTT3DEngine::create(size, settings[1].algorithm))
+	};
+	Results results;
+	memset(&results, 0, sizeof(results));
+
+	if (!configure(engines[0].get(), settings[0]) || !configure(engines[1].get(), settings[1]))
+	{
+		fprintf(stderr, "ttt3d-tournament: cannot load database\n");
+		exit(1);
+	}
+
+	for (int game = nextGame++; game < games; game = nextGame++)
+	{
+		int first	= game & 1;		// engine playing player 1
+		std::vector<int> moves(size * size * size);
+		int count	= randomOpening(game / 2, &moves[0]);
+
+		engines[0]->reset();
+		engines[1]->reset();
+		for (int i = 0; i < count; i++)
+		{
+			engines[0]->makeMove(moves[i], (i & 1) + 1);
+			engines[1]->makeMove(moves[i], (i & 1) + 1);
+		}
+
+		int result;
+		while ((result = engines[0]->getResult()) == 0)
+		{
+			int player	= engines[0]->currentPlayer();
+			int side	= (player == 1) ? first : first ^ 1;
+			int move	= engines[side]->think();
+
+			results.nodes[side]	+= engines[side]->nodes();
+			results.moves++;
+			moves[count++]	= move;
+			engines[0]->makeMove(move, player);
+			engines[1]->makeMove(move, player);
+		}
+
+		int color = first;			// 0 when engine A is player 1
+		if (result == 3)
+			results.draws[color]++;
+		else if ((result == 1) == (first == 0))
+			results.wins[color]++;
+		else
+			results.losses[color]++;
+
+		if (verbose)
+		{
+			std::string line;
+			char buffer[16];
+			for (int i = 0; i < count; i++)
+			{
+				sprintf(buffer, i ? " %d" : "%d", moves[i]);
+				line	+= buffer;
+			}
+
+			std::lock_guard<std::mutex> lock(resultsMutex);
+			printf("game %d: %s first, %s: %s\n", game, first ? "B" : "A",
+				(result == 3) ? "draw" : ((result == 1) ? "player 1 wins" : "player 2 wins"), line.c_str());
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(resultsMutex);
+	for (int color = 0; color < 2; color++)
+	{
+		total.wins[color]	+= results.wins[color];
+		total.draws[color]	+= results.draws[color];
+		total.losses[color]	+= results.losses[color];
+		total.nodes[color]	+= results.nodes[color];
+	}
+	total.moves	+= results.moves;
+}
+
+int main(int argc, char *argv[])
+{
+	int threads	= std::max(1u, std::thread::hardware_concurrency());
+
+	for (int side = 0; side < 2; side++)
+	{
+		settings[side].msecs	= 100;
+		settings[side].nodes	= 0;
+		settings[side].threads	= 1;
+		settings[side].book	= true;
+		settings[side].algorithm	= TTT3DEngine::Negamax;
+	}
+
+	for (int i = 1; i < argc; i++)
+	{
+		const char *arg = argv[i];
+		bool hasValue	= i + 1 < argc;
+		bool ok		= true;
+
+		if ((strcmp(arg, "--size") == 0) && hasValue)
+			size		= atoi(argv[++i]);
+		else if ((strcmp(arg, "-g") == 0) && hasValue)
+			games		= atoi(argv[++i]);
+		else if ((strcmp(arg, "-j") == 0) && hasValue)
+			threads		= std::max(1, atoi(argv[++i]));
+		else if ((strcmp(arg, "-r") == 0) && hasValue)
+			randomPlies	= std::min(std::max(0, atoi(argv[++i])), 4);
+		else if ((strcmp(arg, "-s") == 0) && hasValue)
+			seed		= strtoul(argv[++i], 0, 10);
+		else if ((strcmp(arg, "-a") == 0) && hasValue)
+			ok		= parseSettings(argv[++i], &settings[0]);
+		else if ((strcmp(arg, "-b") == 0) && hasValue)
+			ok		= parseSettings(argv[++i], &settings[1]);
+		else if (strcmp(arg, "-v") == 0)
+			verbose		= true;
+		else
+			ok		= false;
+
+		if (!ok)
+		{
+			fprintf(stderr, "usage: ttt3d-tournament [--size n] [-g games] [-j threads] [-r plies] [-s seed] [-a settings] [-b settings] [-v]\n");
+			return 2;
+		}
+	}
+
+	if ((size < TTT3D_MIN_SIZE) || (size > TTT3D_MAX_SIZE))
+	{
+		fprintf(stderr, "ttt3d-tournament: boards of size %d to %d only\n", TTT3D_MIN_SIZE, TTT3D_MAX_SIZE);
+		return 2;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> pool;
+	for (int i = 0; i < threads; i++)
+		pool.push_back(std::thread(worker));
+	for (int i = 0; i < threads; i++)
+		pool[i].join();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	int wins	= total.wins[0] + total.wins[1];
+	int draws	= total.draws[0] + total.draws[1];
+	int losses	= total.losses[0] + total.losses[1];
+	printf("games %d  A wins %d  draws %d  A losses %d  score %.1f%%\n", games, wins, draws, losses,
+		games ? 100.0 * (wins + 0.5 * draws) / games : 0.0);
+	printf("A as player 1: %d-%d-%d  A as player 2: %d-%d-%d\n",
+		total.wins[0], total.draws[0], total.losses[0], total.wins[1], total.draws[1], total.losses[1]);
+	printf("nodes A %lld  B %lld  moves %d\n", (long long)total.nodes[0], (long long)total.nodes[1], total.moves);
+	printf("%.2f s, %.1f games/s, %.0f moves/s on %d threads\n", seconds,
+		seconds > 0 ? games / seconds : 0.0, seconds > 0 ? total.moves / seconds : 0.0, threads);
+	return 0;
+}
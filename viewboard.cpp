@@ -19,6 +19,8 @@ ViewBoard::ViewBoard(QWidget *p, Qt::WindowFlags f)
 	: QWidget (p, f)
 {
 	m_computerEnabled	= false;
+	m_size			= 3;
+	m_algorithm		= TTT3DEngine::Negamax;
 
 	m_cubeWid 		= new Cube();
 	connect(m_cubeWid, SIGNAL(marked(int)), this, SLOT(humanMove(int)));
@@ -55,6 +57,8 @@ ViewBoard::ViewBoard(QWidget *p, Qt::WindowFlags f)
 	setLayout(layout2);
 
 	m_negamax		= new TTT3DNegamax();
+	m_negamax		->loadDatabase(QCoreApplication::applicationDirPath() + "/ttt3d.db");	// optional
+	m_negamax		->setPondering(true);	// search while the human thinks
 	connect(m_negamax, SIGNAL(done(int)),	this, SLOT(computerMove(int)));
 	connect(m_negamax, SIGNAL(victory(int)),this, SLOT(winOrDraw(int)));
 }
@@ -97,8 +101,15 @@ void ViewBoard::setPlayers(Player one, Player two)
 
 	m_labelMax	->setText(tr("%1 : [Green]").arg(text1));
 	m_labelMin	->setText(tr("%1 : [Blue]").arg(text2));
+
+	m_cubeWid	->setSize(m_size);
+	m_negamax	->setBoardSize(m_size);
+	m_negamax	->setAlgorithm(m_algorithm);
 	reset();
 
+	// The delay only lets Computer vs. Computer be watched; a human gets the answer at once.
+	m_negamax	->setDisplayDelay((one == Human) || (two == Human) ? 0 : 2000);
+
 	if (m_player1 == Computer)
 	{	// First player is a computer, lock keyboard inputs and activate negamax.
 		m_cubeWid	->releaseKeyboard();
@@ -109,6 +120,23 @@ void ViewBoard::setPlayers(Player one, Player two)
 		m_cubeWid	->grabKeyboard();
 }
 
+/*
+	Play the games started from now on on a size x size x size board.
+*/
+void ViewBoard::setBoardSize(int size)
+{
+	m_size	= size;
+}
+
+/*
+	Let the computer play the games started from now on with algorithm,
+		TTT3DEngine::Negamax or TTT3DEngine::MonteCarlo.
+*/
+void ViewBoard::setAlgorithm(int algorithm)
+{
+	m_algorithm	= algorithm;
+}
+
 /*
 	Human player has selected a move.
 	Find out which square is activated; translate the location in grid
@@ -120,6 +148,10 @@ void ViewBoard::humanMove(int move)
 	bool good;
 	current		= m_negamax->currentPlayer();
 
+	// never a human move for the computer's side (Cube ignores input while it has no keyboard)
+	if (((current == 1) ? m_player1 : m_player2) == Computer)
+		return;
+
 	// not blank, return
 	good = m_cubeWid->markCube((Cube::PlayerCube)(current));
 	if (!good)
@@ -171,10 +203,11 @@ void ViewBoard::computerMove(int move)
 
 	// translating 1D location in the array to 3D location for the Cube to display.
 	int x, y, z, temp, current;
-	z 		= move%3;
-	temp 		= move/3;
-	y		= temp%3;
-	x		= temp/3;
+	int size	= m_cubeWid->size();	// m_size may already be the one of the next game
+	z 		= move%size;
+	temp 		= move/size;
+	y		= temp%size;
+	x		= temp/size;
 
 	// set the location.
 	m_cubeWid	->setAxis(x, y, z);
@@ -20,6 +20,8 @@ public:
 			ViewBoard	(QWidget *p = 0, Qt::WindowFlags f = 0);
 	enum		Player		{Human=1, Computer};
 	void		setPlayers	(Player, Player);
+	void		setBoardSize	(int);
+	void		setAlgorithm	(int);
 
 signals:
 	void		endTurn		();
@@ -43,6 +45,8 @@ private:
 	Player		m_player2;
 
 	bool		m_computerEnabled;
+	int		m_size;			// board of the next game, m_size^3 squares
+	int		m_algorithm;		// TTT3DEngine::Algorithm of the computer in the next game
 
 	TTT3DNegamax	*m_negamax;
 };